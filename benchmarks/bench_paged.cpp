@@ -0,0 +1,105 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+/**
+ * Lookups in a trie on disk: one at a time against batches of lookups in flight at once,
+ * then lookups of hot keys, all served from a cache, by a growing number of calling threads,
+ * with and without pinned top pages.
+ * Usage: bench_paged [words_count] [lookups_count] [cache_pages] [batch] [max_threads]
+ * A file is written to a temporary directory; once read it is likely in an OS page cache,
+ * so drop it there to measure a cold disk.
+ * */
+
+#include "../include/paged_trie.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	std::vector<std::string> make_words (std::size_t count, std::mt19937& gen) {
+		std::uniform_int_distribution<int> letter (0, 25), length (4, 16);
+		std::vector<std::string> res (count);
+		for (auto& word : res) {
+			word.resize(static_cast<std::size_t>(length(gen)));
+			for (auto& c : word) c = static_cast<char>('a' + letter(gen));
+		}
+		return res;
+	}
+
+}//!namespace
+
+int main(int argc, char **argv) {
+	std::size_t const words_count {argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500'000u};
+	std::size_t const lookups_count {argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200'000u};
+	std::size_t const cache_pages {argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1024u};
+	std::size_t const batch {argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 256u};
+	std::size_t const max_threads {argc > 5 ? std::strtoul(argv[5], nullptr, 10) : 8u};
+
+	std::mt19937 gen (42);
+	auto const words {make_words(words_count, gen)};
+	auto const path {std::filesystem::temp_directory_path() / "bench_paged.bin"};
+	{
+		::containers::trie::of_char trie;
+		for (auto const& word : words) trie.insert(word);
+		::containers::trie::paged_of_char::write(trie, path);
+	}
+
+	std::vector<std::string const*> lookups (lookups_count);
+	std::uniform_int_distribution<std::size_t> any (0u, words.size() - 1u);
+	for (auto& lookup : lookups) lookup = &words[any(gen)];
+
+	std::printf("%zu words, %zu lookups, %zu cached pages of %zu\n", words.size(), lookups.size(), cache_pages,
+	            static_cast<std::size_t>(std::filesystem::file_size(path) / ::containers::trie::paged_of_char::k_page_size));
+	std::printf("%-24s %12s %14s %10s\n", "mode", "ns/lookup", "pages/lookup", "found");
+	for (std::size_t in_flight : {std::size_t{1u}, batch}) {
+		::containers::trie::paged_of_char const paged (path, {.cache_pages = cache_pages, .io_threads = 4u});
+		std::size_t found {0u};
+		auto const start {std::chrono::steady_clock::now()};
+		for (std::size_t first = 0; first < lookups.size(); first += in_flight) {
+			std::vector<::containers::trie::task<bool>> tasks;
+			for (std::size_t i = first; i != std::min(first + in_flight, lookups.size()); ++i) {
+				tasks.push_back(paged.find_word_async(*lookups[i]));
+			}
+			for (bool is_found : ::containers::trie::sync_wait(std::move(tasks))) found += is_found;
+		}
+		std::chrono::duration<double, std::nano> const elapsed {std::chrono::steady_clock::now() - start};
+		double const n {static_cast<double>(lookups.size())};
+		std::string const mode {in_flight == 1u ? std::string("one at a time") : std::to_string(in_flight) + " in flight"};
+		std::printf("%-24s %12.1f %14.2f %10zu\n", mode.c_str(), elapsed.count() / n, double(paged.pages_read()) / n, found);
+	}
+
+	//a hot set small enough to stay cached, every caller looks its keys up synchronously
+	std::vector<std::string const*> const hot (lookups.begin(), lookups.begin() + static_cast<std::ptrdiff_t>(std::min<std::size_t>(lookups.size(), 64u)));
+	std::printf("\n%8s %20s %20s\n", "threads", "no pinned, Mops/s", "16 pinned, Mops/s");
+	for (std::size_t threads_count = 1; threads_count <= max_threads; threads_count *= 2) {
+		std::printf("%8zu", threads_count);
+		for (std::size_t pinned_pages : {std::size_t{0u}, std::size_t{16u}}) {
+			::containers::trie::paged_of_char const paged (path, {.cache_pages = cache_pages, .io_threads = 4u, .pinned_pages = pinned_pages});
+			for (auto const* word : hot) (void)::containers::trie::sync_wait(paged.find_word_async(*word));
+			std::size_t const per_thread {lookups.size() / threads_count};
+			std::vector<std::thread> threads;
+			auto const start {std::chrono::steady_clock::now()};
+			for (std::size_t t = 0; t != threads_count; ++t) {
+				threads.emplace_back([&, t]{
+					for (std::size_t i = 0; i != per_thread; ++i) {
+						(void)::containers::trie::sync_wait(paged.find_word_async(*hot[(i + t) % hot.size()]));
+					}
+				});
+			}
+			for (auto& thread : threads) thread.join();
+			std::chrono::duration<double> const elapsed {std::chrono::steady_clock::now() - start};
+			std::printf(" %20.2f", double(per_thread * threads_count) / elapsed.count() / 1e6);
+		}
+		std::printf("\n");
+	}
+	std::filesystem::remove(path);
+	return 0;
+}
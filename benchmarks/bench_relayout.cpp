@@ -0,0 +1,159 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+/**
+ * Cold lookups in a trie much larger than a cache: of_char as built against frozen layouts.
+ * Usage: bench_relayout [words_count] [lookups_count]
+ * Cache and dTLB misses per lookup are read from perf counters where perf_event_open is allowed
+ * (see /proc/sys/kernel/perf_event_paranoid), otherwise n/a is printed.
+ * */
+
+#include "../include/trie.hpp"
+#include "../include/frozen_trie.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define TRIE_BENCH_HAS_PERF 1
+#endif
+
+namespace {
+
+	class counter final {
+	public:
+		counter (std::uint32_t type, std::uint64_t config) {
+#if defined(TRIE_BENCH_HAS_PERF)
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = type;
+			attr.config = config;
+			attr.disabled = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+			(void)type;
+			(void)config;
+#endif
+		}
+		counter (counter const&) = delete;
+		counter& operator= (counter const&) = delete;
+		~counter () {
+#if defined(TRIE_BENCH_HAS_PERF)
+			if (fd != -1) close(fd);
+#endif
+		}
+
+		void start () {
+#if defined(TRIE_BENCH_HAS_PERF)
+			if (fd == -1) return;
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+		}
+
+		//-1 if counters are not available
+		double stop () {
+#if defined(TRIE_BENCH_HAS_PERF)
+			if (fd == -1) return -1.0;
+			ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+			std::uint64_t value {0u};
+			if (read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) return -1.0;
+			return static_cast<double>(value);
+#else
+			return -1.0;
+#endif
+		}
+
+	private:
+		int fd {-1};
+	};
+
+	std::vector<std::string> make_words (std::size_t count, std::mt19937& gen) {
+		std::uniform_int_distribution<int> letter (0, 25), length (4, 16);
+		std::vector<std::string> res (count);
+		for (auto& word : res) {
+			word.resize(static_cast<std::size_t>(length(gen)));
+			for (auto& c : word) c = static_cast<char>('a' + letter(gen));
+		}
+		return res;
+	}
+
+	template <typename Trie>
+	void run (char const* name, Trie const& trie, std::vector<std::string const*> const& lookups) {
+#if defined(TRIE_BENCH_HAS_PERF)
+		counter cache_misses (PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+		counter tlb_misses (PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB |
+		                                        (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+		                                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u));
+#else
+		counter cache_misses (0u, 0u);
+		counter tlb_misses (0u, 0u);
+#endif
+		std::size_t found {0u};
+		cache_misses.start();
+		tlb_misses.start();
+		auto const start {std::chrono::steady_clock::now()};
+		for (auto const* word : lookups) found += trie.find_word(*word);
+		std::chrono::duration<double, std::nano> const elapsed {std::chrono::steady_clock::now() - start};
+		double const cache {cache_misses.stop()}, tlb {tlb_misses.stop()};
+
+		double const n {static_cast<double>(lookups.size())};
+		std::printf("%-24s %10.1f", name, elapsed.count() / n);
+		if (cache < 0.0) std::printf(" %14s", "n/a");
+		else std::printf(" %14.2f", cache / n);
+		if (tlb < 0.0) std::printf(" %14s", "n/a");
+		else std::printf(" %14.2f", tlb / n);
+		std::printf("   (found %zu)\n", found);
+	}
+
+}//!namespace
+
+int main(int argc, char **argv) {
+	std::size_t const words_count {argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500'000u};
+	std::size_t const lookups_count {argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1'000'000u};
+
+	std::mt19937 gen (42);
+	auto const words {make_words(words_count, gen)};
+
+	::containers::trie::of_char trie;
+	for (auto const& word : words) trie.insert(word);
+
+	//skewed lookups, a tenth of the words gets most of them, the first thousand of those is given as samples
+	std::vector<std::string const*> lookups (lookups_count);
+	std::uniform_int_distribution<std::size_t> hot (0u, words.size() / 10u), any (0u, words.size() - 1u);
+	std::uniform_int_distribution<int> percent (0, 99);
+	for (auto& lookup : lookups) lookup = &words[percent(gen) < 90 ? hot(gen) : any(gen)];
+	std::vector<std::string> samples;
+	for (std::size_t i = 0; i != std::min<std::size_t>(lookups.size(), 1000u); ++i) samples.push_back(*lookups[i]);
+
+	using ::containers::trie::node_order;
+	using ::containers::trie::relayout_options;
+	::containers::trie::frozen_of_char const breadth_first (trie, relayout_options{node_order::breadth_first, 0u, false});
+	::containers::trie::frozen_of_char const blocked (trie, relayout_options{});
+	::containers::trie::frozen_of_char const guided (trie, samples, relayout_options{});
+	::containers::trie::frozen_of_char const huge (trie, samples, relayout_options{node_order::blocked, 1u << 12, true});
+
+	std::printf("%zu words, %zu nodes, %zu lookups\n", words.size(), blocked.nodes_count(), lookups.size());
+	std::printf("%-24s %10s %14s %14s\n", "layout", "ns/lookup", "cache misses", "dTLB misses");
+	run("of_char", trie, lookups);
+	run("breadth first", breadth_first, lookups);
+	run("blocked", blocked, lookups);
+	run("blocked, by frequency", guided, lookups);
+	run("blocked, huge pages", huge, lookups);
+	return 0;
+}
@@ -0,0 +1,101 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+/**
+ * Mixed read/insert throughput of one of_char behind a single reader-writer lock against a sharded trie.
+ * Usage: bench_sharded [max_threads] [ops_total]
+ * Thread count is swept as powers of two up to max_threads, read share as 50%, 90% and 99%.
+ * */
+
+#include "../include/trie.hpp"
+#include "../include/sharded_trie.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+	struct locked_trie final {
+		mutable std::shared_mutex mutex;
+		::containers::trie::of_char trie;
+
+		void insert (std::string const& word) {
+			std::unique_lock const lock {mutex};
+			trie.insert(word);
+		}
+		bool find_word (std::string const& word) const {
+			std::shared_lock const lock {mutex};
+			return trie.find_word(word);
+		}
+	};
+
+	std::vector<std::string> make_words (std::size_t count, std::mt19937& gen) {
+		std::uniform_int_distribution<int> letter (0, 25), length (3, 12);
+		std::vector<std::string> res (count);
+		for (auto& word : res) {
+			word.resize(static_cast<std::size_t>(length(gen)));
+			for (auto& c : word) c = static_cast<char>('a' + letter(gen));
+		}
+		return res;
+	}
+
+	template <typename Trie>
+	double run (Trie& trie, std::vector<std::string> const& words,
+	            std::size_t threads_count, int read_percent, std::size_t ops_total) {
+		std::size_t const ops_per_thread {ops_total / threads_count};
+		std::vector<std::thread> threads;
+		std::atomic<std::size_t> found {0u};
+		auto const start {std::chrono::steady_clock::now()};
+		for (std::size_t t = 0; t != threads_count; ++t) {
+			threads.emplace_back([&, t]{
+				std::mt19937 gen (static_cast<unsigned>(t));
+				std::uniform_int_distribution<std::size_t> word (0u, words.size() - 1u);
+				std::uniform_int_distribution<int> percent (0, 99);
+				std::size_t local_found {0u};
+				for (std::size_t i = 0; i != ops_per_thread; ++i) {
+					auto const& w {words[word(gen)]};
+					if (percent(gen) < read_percent) local_found += trie.find_word(w);
+					else trie.insert(w);
+				}
+				found += local_found;
+			});
+		}
+		for (auto& thread : threads) thread.join();
+		std::chrono::duration<double> const elapsed {std::chrono::steady_clock::now() - start};
+		return double(ops_per_thread * threads_count) / elapsed.count() / 1e6;
+	}
+
+}//!namespace
+
+int main(int argc, char **argv) {
+	std::size_t const max_threads {argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32u};
+	std::size_t const ops_total {argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1'000'000u};
+
+	std::mt19937 gen (42);
+	auto const words {make_words(200'000u, gen)};
+
+	std::printf("%8s %6s %16s %16s\n", "threads", "reads", "locked, Mops/s", "sharded, Mops/s");
+	for (int read_percent : {50, 90, 99}) {
+		for (std::size_t threads_count = 1; threads_count <= max_threads; threads_count *= 2) {
+			locked_trie locked;
+			::containers::trie::sharded_of_char<> sharded;
+			for (std::size_t i = 0; i < words.size(); i += 2u) {
+				locked.insert(words[i]);
+				sharded.insert(words[i]);
+			}
+			double const locked_mops {run(locked, words, threads_count, read_percent, ops_total)};
+			double const sharded_mops {run(sharded, words, threads_count, read_percent, ops_total)};
+			std::printf("%8zu %5d%% %16.2f %16.2f\n", threads_count, read_percent, locked_mops, sharded_mops);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,117 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+/**
+ * Greedy longest-match tokenization throughput.
+ * Usage: bench_tokenizer [corpus_file] [vocabulary_file]
+ * With no arguments a synthetic corpus of 128MB made of vocabulary words is used.
+ * */
+
+#include "../include/tokenizer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+	struct counter_t final {
+		std::size_t count {0u}, checksum {0u};
+	};
+
+	//output iterator that only folds tokens, so nothing but the tokenizer itself is measured
+	struct counting_iterator final {
+		using difference_type = std::ptrdiff_t;
+		counter_t* counter;
+
+		counting_iterator& operator* () noexcept { return *this; }
+		counting_iterator& operator++ () noexcept { return *this; }
+		counting_iterator operator++ (int) noexcept { return *this; }
+		counting_iterator& operator= (::containers::trie::token<std::size_t> const& t) noexcept {
+			++counter->count;
+			counter->checksum += t.offset ^ t.payload;
+			return *this;
+		}
+	};
+
+	std::vector<std::string> make_vocabulary (std::size_t words_count, std::mt19937& gen) {
+		std::uniform_int_distribution<int> letter (0, 25), length (2, 10);
+		std::vector<std::string> res (words_count);
+		for (auto& word : res) {
+			word.resize(static_cast<std::size_t>(length(gen)));
+			for (auto& c : word) c = static_cast<char>('a' + letter(gen));
+		}
+		return res;
+	}
+
+	//words are drawn by Zipf's law, as in a natural text
+	std::string make_corpus (std::vector<std::string> const& vocabulary, std::size_t bytes, std::mt19937& gen) {
+		std::vector<double> weights (vocabulary.size());
+		for (std::size_t i = 0; i != weights.size(); ++i) weights[i] = 1.0 / double(i + 1u);
+		std::discrete_distribution<std::size_t> word (weights.begin(), weights.end());
+		std::string res;
+		res.reserve(bytes + 16u);
+		while (res.size() < bytes) {
+			res += vocabulary[word(gen)];
+			res += ' ';
+		}
+		return res;
+	}
+
+	std::vector<std::string> read_words (char const* path) {
+		std::vector<std::string> res;
+		std::ifstream f (path);
+		std::string word;
+		while (f >> word) res.push_back(word);
+		return res;
+	}
+
+	std::string read_file (char const* path) {
+		std::ifstream f (path, std::ios::binary);
+		return {std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>()};
+	}
+
+	template <typename Func>
+	void report (char const* name, std::size_t bytes, Func&& func) {
+		counter_t counter;
+		auto const start {std::chrono::steady_clock::now()};
+		func(counting_iterator{&counter});
+		std::chrono::duration<double> const elapsed {std::chrono::steady_clock::now() - start};
+		std::printf("%-24s %8.3f GB/s  %12zu tokens  (checksum %zu)\n",
+		            name, double(bytes) / elapsed.count() / 1e9, counter.count, counter.checksum);
+	}
+
+}//!namespace
+
+int main(int argc, char **argv) {
+	std::mt19937 gen (42);
+	auto const vocabulary {argc > 2 ? read_words(argv[2]) : make_vocabulary(50'000u, gen)};
+	auto const corpus {argc > 1 ? read_file(argv[1]) : make_corpus(vocabulary, 128u << 20, gen)};
+
+	::containers::trie::tokenizer_of_char<> tokenizer (vocabulary);
+	std::printf("vocabulary %zu words, corpus %zu bytes\n", vocabulary.size(), corpus.size());
+
+	report("buffer", corpus.size(), [&](counting_iterator out){
+		tokenizer.tokenize(corpus, out);
+	});
+
+	for (std::size_t chunk_size : {4096u, 1u << 20}) {
+		std::string const name {"stream, chunk " + std::to_string(chunk_size)};
+		report(name.c_str(), corpus.size(), [&](counting_iterator out){
+			auto stream {tokenizer.stream()};
+			std::span<char const> const all {corpus};
+			for (std::size_t pos = 0; pos < all.size(); pos += chunk_size) {
+				out = stream.feed(all.subspan(pos, std::min(chunk_size, all.size() - pos)), out);
+			}
+			stream.finish(out);
+		});
+	}
+
+	return 0;
+}
@@ -0,0 +1,82 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+/**
+ * Lookups of mostly-ASCII keys: of_char against the UTF-8 tries, with and without case folding.
+ * Usage: bench_utf8 [words_count] [non_ascii_percent]
+ * */
+
+#include "../include/trie.hpp"
+#include "../include/utf8_trie.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+	std::vector<std::string> make_words (std::size_t count, int non_ascii_percent, std::mt19937& gen) {
+		std::uniform_int_distribution<int> letter (0, 25), length (3, 12), percent (0, 99);
+		std::vector<std::string> res (count);
+		for (auto& word : res) {
+			int const len {length(gen)};
+			for (int i = 0; i != len; ++i) {
+				if (percent(gen) < non_ascii_percent) word += "é";
+				else word += static_cast<char>((percent(gen) < 10 ? 'A' : 'a') + letter(gen));
+			}
+		}
+		return res;
+	}
+
+	template <typename Trie>
+	void report (char const* name, Trie const& trie, std::vector<std::string> const& queries) {
+		std::size_t found {0u}, bytes {0u};
+		auto const start {std::chrono::steady_clock::now()};
+		for (int round = 0; round != 10; ++round) {
+			for (auto const& query : queries) {
+				found += trie.find_word(query);
+				bytes += query.size();
+			}
+		}
+		std::chrono::duration<double> const elapsed {std::chrono::steady_clock::now() - start};
+		std::printf("%-16s %8.1f ns/lookup %8.3f GB/s  (%zu found)\n",
+		            name, elapsed.count() * 1e9 / double(queries.size() * 10u),
+		            double(bytes) / elapsed.count() / 1e9, found);
+	}
+
+}//!namespace
+
+int main(int argc, char **argv) {
+	std::size_t const words_count {argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200'000u};
+	int const non_ascii_percent {argc > 2 ? std::atoi(argv[2]) : 0};
+
+	std::mt19937 gen (42);
+	auto const words {make_words(words_count, non_ascii_percent, gen)};
+	auto queries {make_words(words_count, non_ascii_percent, gen)};
+	for (std::size_t i = 0; i < words.size(); i += 2u) queries[i] = words[i];
+	std::shuffle(queries.begin(), queries.end(), gen);
+
+	::containers::trie::of_utf8 utf8;
+	::containers::trie::of_utf8_nocase utf8_nocase;
+	for (auto const& word : words) {
+		utf8.insert(word);
+		utf8_nocase.insert(word);
+	}
+	std::printf("%zu words, %d%% non-ASCII symbols, %zu nodes\n", words.size(), non_ascii_percent, utf8.nodes_count());
+
+	//of_char can only hold ASCII letters and is case insensitive, so it is measured with no non-ASCII symbols only
+	if (non_ascii_percent == 0) {
+		::containers::trie::of_char ascii;
+		for (auto const& word : words) ascii.insert(word);
+		report("of_char", ascii, queries);
+	}
+	report("of_utf8", utf8, queries);
+	report("of_utf8_nocase", utf8_nocase, queries);
+
+	return 0;
+}
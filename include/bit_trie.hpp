@@ -0,0 +1,227 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include "trie.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <limits>
+#include <array>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <cstdint>
+
+namespace containers {
+
+	namespace trie {
+
+		namespace details {
+
+			/**
+			 * Binary trie over the bit pattern of an integral key, MSB first.
+			 * Keys are kept as a multiset, every node stores the number of keys in its subtree,
+			 * so all the queries below take O(width) and allocate nothing.
+			 * Only the lowest `width` bits of a key are used, signed keys are treated as their unsigned
+			 * two's complement pattern, i.e. XOR and comparisons are done on bits_type.
+			 * */
+			template<std::integral T, std::size_t width = std::numeric_limits<std::make_unsigned_t<T>>::digits>
+			requires (width > 0u && width <= std::numeric_limits<std::make_unsigned_t<T>>::digits)
+			class BitTrie final {
+			public:
+				using value_type = T;
+				using bits_type = std::make_unsigned_t<T>;
+				static constexpr std::size_t k_width {width};
+
+			private:
+				using index_t = std::uint32_t;
+
+				//next[b] is 0 while a node has no child for bit b
+				struct node_t final {
+					std::array<index_t, 2u> next {0u, 0u};
+					std::size_t count {0u};
+				};
+
+			public:
+
+				BitTrie () : nodes (1u)
+				{}
+
+				template <typename Container>
+				requires requirements::containers::IsContainerOfT<Container, T>
+				BitTrie (Container const& c) : nodes (1u)
+				{
+					insert(c);
+				}
+
+				void insert (T t) {
+					bits_type const bits {static_cast<bits_type>(t)};
+					index_t curr {0u};
+					++nodes[curr].count;
+					for (std::size_t i = width; i != 0u; --i) {
+						std::size_t const b {bit(bits, i - 1u)};
+						if (nodes[curr].next[b] == 0u) {
+							nodes[curr].next[b] = static_cast<index_t>(nodes.size());
+							nodes.emplace_back();
+						}
+						curr = nodes[curr].next[b];
+						++nodes[curr].count;
+					}
+				}
+
+				template <typename Container>
+				requires requirements::containers::IsContainerOfT<Container, T>
+				void insert (Container const& c) {
+					for (T const& t : c) insert(t);
+				}
+
+				template <std::input_iterator Iter>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				void insert (Iter first, Iter last) {
+					for (auto it = first; it != last; ++it) insert(*it);
+				}
+
+				//removes one occurrence, nodes are kept for reuse and treated as absent when their count drops to zero
+				bool erase (T t) noexcept {
+					if (count(t) == 0u) return false;
+					bits_type const bits {static_cast<bits_type>(t)};
+					index_t curr {0u};
+					--nodes[curr].count;
+					for (std::size_t i = width; i != 0u; --i) {
+						curr = nodes[curr].next[bit(bits, i - 1u)];
+						--nodes[curr].count;
+					}
+					return true;
+				}
+
+				std::size_t count (T t) const noexcept {
+					bits_type const bits {static_cast<bits_type>(t)};
+					index_t curr {0u};
+					for (std::size_t i = width; i != 0u; --i) {
+						index_t const next {child(curr, bit(bits, i - 1u))};
+						if (next == 0u) return 0u;
+						curr = next;
+					}
+					return nodes[curr].count;
+				}
+
+				bool contains (T t) const noexcept {
+					return count(t) != 0u;
+				}
+
+				std::size_t size () const noexcept {
+					return nodes[0u].count;
+				}
+
+				bool empty () const noexcept {
+					return size() == 0u;
+				}
+
+				//max of (x ^ y) over all stored y
+				std::optional<bits_type> max_xor (T x) const noexcept {
+					return empty() ? std::nullopt : std::optional<bits_type>{extreme_xor_<true>(x)};
+				}
+
+				//min of (x ^ y) over all stored y
+				std::optional<bits_type> min_xor (T x) const noexcept {
+					return empty() ? std::nullopt : std::optional<bits_type>{extreme_xor_<false>(x)};
+				}
+
+				//number of stored y such that (x ^ y) < k
+				std::size_t count_xor_less (T x, bits_type k) const noexcept {
+					if constexpr (width < std::numeric_limits<bits_type>::digits) {
+						if ((k >> width) != 0u) return size();
+					}
+					bits_type const bits {static_cast<bits_type>(x)};
+					std::size_t res {0u};
+					index_t curr {0u};
+					for (std::size_t i = width; i != 0u; --i) {
+						std::size_t const xb {bit(bits, i - 1u)};
+						if (bit(k, i - 1u) == 1u) {
+							if (index_t const same {child(curr, xb)}; same != 0u) {
+								res += nodes[same].count;
+							}
+							curr = child(curr, xb ^ 1u);
+						}
+						else {
+							curr = child(curr, xb);
+						}
+						if (curr == 0u) break;
+					}
+					return res;
+				}
+
+				/**
+				 * Batch forms: one result per input value is written to out.
+				 * For an empty trie nothing is written, as there is nothing to XOR with.
+				 * */
+				template <std::input_iterator Iter, std::output_iterator<bits_type> Out>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				Out max_xor (Iter first, Iter last, Out out) const {
+					if (empty()) return out;
+					for (auto it = first; it != last; ++it) *out++ = extreme_xor_<true>(*it);
+					return out;
+				}
+
+				template <std::input_iterator Iter, std::output_iterator<bits_type> Out>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				Out min_xor (Iter first, Iter last, Out out) const {
+					if (empty()) return out;
+					for (auto it = first; it != last; ++it) *out++ = extreme_xor_<false>(*it);
+					return out;
+				}
+
+				template <std::input_iterator Iter, std::output_iterator<std::size_t> Out>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				Out count_xor_less (Iter first, Iter last, bits_type k, Out out) const {
+					for (auto it = first; it != last; ++it) *out++ = count_xor_less(*it, k);
+					return out;
+				}
+
+			private:
+				std::vector<node_t> nodes;
+
+			private:
+
+				static std::size_t bit (bits_type bits, std::size_t pos) noexcept {
+					return static_cast<std::size_t>((bits >> pos) & 1u);
+				}
+
+				index_t child (index_t curr, std::size_t b) const noexcept {
+					index_t const next {nodes[curr].next[b]};
+					return next != 0u && nodes[next].count != 0u ? next : 0u;
+				}
+
+				//expects a non-empty trie, so there is always at least one branch to follow
+				template <bool maximize>
+				bits_type extreme_xor_ (T x) const noexcept {
+					bits_type const bits {static_cast<bits_type>(x)};
+					bits_type res {0u};
+					index_t curr {0u};
+					for (std::size_t i = width; i != 0u; --i) {
+						std::size_t const xb {bit(bits, i - 1u)};
+						std::size_t const wanted {maximize ? xb ^ 1u : xb};
+						if (index_t const next {child(curr, wanted)}; next != 0u) {
+							curr = next;
+							if constexpr (maximize) res |= bits_type(bits_type(1u) << (i - 1u));
+						}
+						else {
+							curr = child(curr, wanted ^ 1u);
+							if constexpr (!maximize) res |= bits_type(bits_type(1u) << (i - 1u));
+						}
+					}
+					return res;
+				}
+			};
+
+		}//!namespace details
+
+		template<std::integral T, std::size_t Width = std::numeric_limits<std::make_unsigned_t<T>>::digits>
+		using of_bits = details::BitTrie<T, Width>;
+
+	}//!namespace trie
+
+}//!namespace containers
@@ -0,0 +1,296 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include "trie.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <array>
+#include <vector>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <optional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <bit>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace containers {
+
+	namespace trie {
+
+		enum class node_order {
+			breadth_first,
+			//breadth first for the top nodes, then every subtree below them is laid out depth first as one block
+			blocked,
+		};
+
+		struct relayout_options final {
+			node_order order {node_order::blocked};
+			//how many nodes are laid out breadth first before switching to subtree blocks
+			std::size_t top_nodes {1u << 12};
+			//Linux only, transparent huge pages are asked for with madvise(), ignored elsewhere
+			bool huge_pages {false};
+		};
+
+		namespace details {
+
+			inline constexpr std::size_t k_huge_page_size {2u << 20};
+
+			template <typename T>
+			struct HugePageAllocator {
+				using value_type = T;
+
+				bool use_huge_pages {false};
+
+				HugePageAllocator () = default;
+
+				explicit HugePageAllocator (bool use) noexcept : use_huge_pages (use)
+				{}
+
+				template <typename U>
+				HugePageAllocator (HugePageAllocator<U> const& other) noexcept : use_huge_pages (other.use_huge_pages)
+				{}
+
+				T* allocate (std::size_t n) {
+#if defined(__linux__)
+					if (use_huge_pages) {
+						void* p {mmap(nullptr, mapped_size_(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+						if (p == MAP_FAILED) throw std::bad_alloc();
+						madvise(p, mapped_size_(n), MADV_HUGEPAGE);
+						return static_cast<T*>(p);
+					}
+#endif
+					return std::allocator<T>{}.allocate(n);
+				}
+
+				void deallocate (T* p, std::size_t n) noexcept {
+#if defined(__linux__)
+					if (use_huge_pages) {
+						munmap(p, mapped_size_(n));
+						return;
+					}
+#endif
+					std::allocator<T>{}.deallocate(p, n);
+				}
+
+				template <typename U>
+				bool operator== (HugePageAllocator<U> const& other) const noexcept {
+					return use_huge_pages == other.use_huge_pages;
+				}
+
+			private:
+				static std::size_t mapped_size_ (std::size_t n) noexcept {
+					return (n * sizeof(T) + k_huge_page_size - 1u) / k_huge_page_size * k_huge_page_size;
+				}
+			};
+
+			//node of a relaid trie, a symbol without a child maps to 0, see TrieLookup
+			template <std::size_t abc_size>
+			struct packed_node final {
+				std::array<std::uint64_t, (abc_size + 63u) / 64u> mask;
+				std::uint32_t first_child;
+				bool is_leaf;
+
+				//children of a node are stored together, so a child is found by a rank in a mask
+				std::uint32_t child (std::size_t idx) const noexcept {
+					std::size_t const word {idx / 64u}, bit {idx % 64u};
+					if (((mask[word] >> bit) & 1u) == 0u) return 0u;
+					std::size_t rank {static_cast<std::size_t>(std::popcount(mask[word] & ((std::uint64_t{1u} << bit) - 1u)))};
+					for (std::size_t w = 0; w != word; ++w) rank += static_cast<std::size_t>(std::popcount(mask[w]));
+					return first_child + static_cast<std::uint32_t>(rank);
+				}
+
+				template <typename NodeView>
+				static packed_node pack (NodeView node, std::uint32_t first_child) noexcept {
+					packed_node res;
+					res.mask.fill(0u);
+					res.first_child = first_child;
+					res.is_leaf = node.is_leaf();
+					for (std::size_t i = 0; i != node.fanout(); ++i) {
+						if (node.child(i)) res.mask[i / 64u] |= std::uint64_t{1u} << (i % 64u);
+					}
+					return res;
+				}
+			};
+
+			//number of sampled lookups passing a node, by node_view::id()
+			using node_hits_t = std::unordered_map<void const*, std::size_t>;
+
+			template <typename TrieType>
+			struct layout_t final {
+				std::vector<typename TrieType::node_view> order;
+				std::vector<std::uint32_t> first_child;
+			};
+
+			/**
+			 * Every node gets a position first: a node's children are placed as one block when the node is
+			 * taken from a queue (breadth first part) or from a stack (depth first part).
+			 * */
+			template <typename TrieType>
+			layout_t<TrieType> relayout (TrieType const& trie, relayout_options const& options, node_hits_t const& hits) {
+				using node_view = typename TrieType::node_view;
+				using index_t = std::uint32_t;
+
+				std::vector<node_view> order {trie.root_node()};
+				std::vector<index_t> first_child;
+				std::vector<node_view> children;
+
+				auto const hits_of = [&hits](node_view node) {
+					auto const it {hits.find(node.id())};
+					return it == hits.end() ? std::size_t{0u} : it->second;
+				};
+				auto const children_of = [&children](node_view node) {
+					children.clear();
+					for (std::size_t i = 0; i != node.fanout(); ++i) {
+						if (node_view const child {node.child(i)}) children.push_back(child);
+					}
+				};
+				auto const place_children = [&](index_t pos) {
+					children_of(order[pos]);
+					if (first_child.size() <= pos) first_child.resize(pos + 1u, 0u);
+					first_child[pos] = static_cast<index_t>(order.size());
+					order.insert(order.end(), children.begin(), children.end());
+				};
+
+				std::size_t const top_nodes {options.order == node_order::breadth_first ?
+				                             std::numeric_limits<std::size_t>::max() : options.top_nodes};
+				std::deque<index_t> queue {0u};
+				while (!queue.empty()) {
+					index_t const pos {queue.front()};
+					children_of(order[pos]);
+					if (order.size() > 1u && order.size() + children.size() > top_nodes) break;
+					queue.pop_front();
+					index_t const first {static_cast<index_t>(order.size())};
+					place_children(pos);
+					for (index_t i = first; i != order.size(); ++i) queue.push_back(i);
+				}
+
+				std::vector<index_t> frontier (queue.begin(), queue.end());
+				std::stable_sort(frontier.begin(), frontier.end(), [&](index_t lhs, index_t rhs){
+					return hits_of(order[lhs]) > hits_of(order[rhs]);
+				});
+				std::vector<index_t> stack;
+				for (index_t const subtree : frontier) {
+					stack.push_back(subtree);
+					while (!stack.empty()) {
+						index_t const pos {stack.back()};
+						stack.pop_back();
+						index_t const first {static_cast<index_t>(order.size())};
+						place_children(pos);
+						index_t const last {static_cast<index_t>(order.size())};
+						//the hottest child is on top of a stack, so its block comes right after this one
+						std::size_t const stack_size {stack.size()};
+						for (index_t i = last; i != first; --i) stack.push_back(i - 1u);
+						std::stable_sort(stack.begin() + static_cast<std::ptrdiff_t>(stack_size), stack.end(), [&](index_t lhs, index_t rhs){
+							return hits_of(order[lhs]) < hits_of(order[rhs]);
+						});
+					}
+				}
+				first_child.resize(order.size(), 0u);
+				return {std::move(order), std::move(first_child)};
+			}
+
+			/**
+			 * Read-only copy of a Trie with all the nodes in one array, in an order chosen for a cold trie
+			 * much larger than a cache. Children of a node are kept together and found by a bitmask rank,
+			 * so a node is 16 bytes for 26 symbols and four of them share a cache line.
+			 * The blocked order keeps the top of a trie dense and every deeper subtree contiguous,
+			 * so a lookup touches few pages. Sample keys, if given, put hot subtrees first.
+			 * */
+			template<typename T, typename GetIndex, std::size_t abc_size = 26u>
+			requires requirements::conversion::CallableToIndex<GetIndex, T>
+			class FrozenTrie final : public TrieLookup<FrozenTrie<T, GetIndex, abc_size>, T, GetIndex, abc_size> {
+			public:
+				using value_type = T;
+				using trie_type = Trie<T, GetIndex, abc_size>;
+				static constexpr std::size_t k_abc_size {abc_size};
+
+			private:
+				using index_t = std::uint32_t;
+				using node_view = typename trie_type::node_view;
+
+				using node_t = packed_node<abc_size>;
+
+				friend TrieLookup<FrozenTrie, T, GetIndex, abc_size>;
+
+			public:
+
+				explicit FrozenTrie (trie_type const& trie, relayout_options options = {})
+						: nodes (HugePageAllocator<node_t>{options.huge_pages})
+				{
+					build_(trie, options, {});
+				}
+
+				//samples are keys looked up most often, their paths are laid out first
+				template <typename Samples>
+				requires std::ranges::input_range<Samples> &&
+				         requirements::containers::IsRangeOfT<std::ranges::range_value_t<Samples>, T>
+				FrozenTrie (trie_type const& trie, Samples const& samples, relayout_options options = {})
+						: nodes (HugePageAllocator<node_t>{options.huge_pages})
+				{
+					node_hits_t hits;
+					for (auto const& sample : samples) {
+						node_view node {trie.root_node()};
+						for (auto const& t : sample) {
+							auto const idx {index_of<abc_size>(this->get_idx, t)};
+							if (!idx) break;
+							node = node.child(idx.value());
+							if (!node) break;
+							++hits[node.id()];
+						}
+					}
+					build_(trie, options, hits);
+				}
+
+				std::size_t nodes_count () const noexcept {
+					return nodes.size();
+				}
+
+			private:
+				std::vector<node_t, HugePageAllocator<node_t>> nodes;
+
+			private:
+
+				static index_t lookup_root_ () noexcept {
+					return 0u;
+				}
+
+				index_t lookup_child_ (index_t node, std::size_t idx) const noexcept {
+					return nodes[node].child(idx);
+				}
+
+				bool lookup_is_leaf_ (index_t node) const noexcept {
+					return nodes[node].is_leaf;
+				}
+
+				void build_ (trie_type const& trie, relayout_options const& options, node_hits_t const& hits) {
+					auto const layout {relayout(trie, options, hits)};
+					nodes.reserve(layout.order.size());
+					for (std::size_t pos = 0; pos != layout.order.size(); ++pos) {
+						nodes.push_back(node_t::pack(layout.order[pos], layout.first_child[pos]));
+					}
+				}
+			};
+
+		}//!namespace details
+
+		using frozen_of_char = details::FrozenTrie<char, details::GetIndex, 26u>;
+
+		template<typename T, typename GetIndexFunc, std::size_t ABCSize>
+		using frozen = details::FrozenTrie<T, GetIndexFunc, ABCSize>;
+
+	}//!namespace trie
+
+}//!namespace containers
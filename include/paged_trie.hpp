@@ -0,0 +1,830 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include "trie.hpp"
+#include "frozen_trie.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <array>
+#include <deque>
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <optional>
+#include <iterator>
+#include <memory>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <bit>
+#include <limits>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace containers {
+
+	namespace trie {
+
+		//lazy coroutine result, started when awaited, resumes its awaiter when done
+		template <typename R>
+		class [[nodiscard]] task final {
+		public:
+			struct promise_type;
+			using handle_type = std::coroutine_handle<promise_type>;
+
+			struct promise_type final {
+				std::optional<R> value;
+				std::exception_ptr error;
+				std::coroutine_handle<> continuation;
+
+				struct final_awaiter final {
+					bool await_ready () const noexcept {
+						return false;
+					}
+					std::coroutine_handle<> await_suspend (handle_type handle) noexcept {
+						auto const continuation {handle.promise().continuation};
+						return continuation ? continuation : std::noop_coroutine();
+					}
+					void await_resume () const noexcept {}
+				};
+
+				task get_return_object () noexcept {
+					return task{handle_type::from_promise(*this)};
+				}
+				std::suspend_always initial_suspend () const noexcept {
+					return {};
+				}
+				final_awaiter final_suspend () const noexcept {
+					return {};
+				}
+				template <typename U>
+				void return_value (U&& v) {
+					value.emplace(std::forward<U>(v));
+				}
+				void unhandled_exception () noexcept {
+					error = std::current_exception();
+				}
+			};
+
+			task (task const&) = delete;
+			task& operator= (task const&) = delete;
+
+			task (task&& other) noexcept : handle (std::exchange(other.handle, {}))
+			{}
+
+			task& operator= (task&& other) noexcept {
+				if (this != &other) {
+					if (handle) handle.destroy();
+					handle = std::exchange(other.handle, {});
+				}
+				return *this;
+			}
+
+			~task () {
+				if (handle) handle.destroy();
+			}
+
+			bool await_ready () const noexcept {
+				return false;
+			}
+
+			std::coroutine_handle<> await_suspend (std::coroutine_handle<> continuation) noexcept {
+				handle.promise().continuation = continuation;
+				return handle;
+			}
+
+			R await_resume () {
+				auto& promise {handle.promise()};
+				if (promise.error) std::rethrow_exception(promise.error);
+				return std::move(*promise.value);
+			}
+
+		private:
+			handle_type handle;
+
+			explicit task (handle_type h) noexcept : handle (h)
+			{}
+		};
+
+		struct paged_options final {
+			//pages of nodes kept in memory, least recently used ones are dropped first
+			std::size_t cache_pages {1024u};
+			//threads reading pages from disk, so many lookups wait for I/O at once
+			std::size_t io_threads {4u};
+			//pages of the top levels, read on opening and never dropped, lookups pass them without any lock
+			std::size_t pinned_pages {16u};
+		};
+
+		namespace details {
+
+			/**
+			 * Coroutines to resume on a thread blocked in sync_wait(), so lookups it started go on there
+			 * and never on an I/O thread, whatever they do after a page is read.
+			 * */
+			class RunQueue final {
+			public:
+				void post (std::coroutine_handle<> handle) {
+					std::lock_guard const lock {mutex};
+					handles.push_back(handle);
+					cv.notify_one();
+				}
+
+				void add_pending (std::size_t count) {
+					std::lock_guard const lock {mutex};
+					pending += count;
+				}
+
+				void complete () {
+					std::lock_guard const lock {mutex};
+					--pending;
+					cv.notify_one();
+				}
+
+				//resumes posted coroutines until every pending task is complete
+				void run () {
+					for (;;) {
+						std::coroutine_handle<> handle;
+						{
+							std::unique_lock lock {mutex};
+							cv.wait(lock, [this]{ return pending == 0u || !handles.empty(); });
+							if (handles.empty()) return;
+							handle = handles.front();
+							handles.pop_front();
+						}
+						handle.resume();
+					}
+				}
+
+			private:
+				std::mutex mutex;
+				std::condition_variable cv;
+				std::deque<std::coroutine_handle<>> handles;
+				std::size_t pending {0u};
+			};
+
+			//a queue of the innermost sync_wait() on this thread, if any
+			inline thread_local std::shared_ptr<RunQueue> current_run_queue;
+			inline thread_local bool is_io_thread {false};
+
+			class RunQueueScope final {
+			public:
+				explicit RunQueueScope (std::shared_ptr<RunQueue> queue) noexcept
+						: previous (std::exchange(current_run_queue, std::move(queue)))
+				{}
+				RunQueueScope (RunQueueScope const&) = delete;
+				RunQueueScope& operator= (RunQueueScope const&) = delete;
+				~RunQueueScope () {
+					current_run_queue = std::move(previous);
+				}
+
+			private:
+				std::shared_ptr<RunQueue> previous;
+			};
+
+			inline void check_not_io_thread () {
+				if (is_io_thread) {
+					throw std::logic_error("sync_wait() on an I/O thread would wait for that very thread, co_await instead");
+				}
+			}
+
+			struct detached_t final {
+				struct promise_type final {
+					detached_t get_return_object () const noexcept {
+						return {};
+					}
+					std::suspend_never initial_suspend () const noexcept {
+						return {};
+					}
+					std::suspend_never final_suspend () const noexcept {
+						return {};
+					}
+					void return_void () const noexcept {}
+					void unhandled_exception () const noexcept {
+						std::terminate();
+					}
+				};
+			};
+
+			template <typename R>
+			detached_t run_detached (task<R> t, std::promise<R> result, std::shared_ptr<RunQueue> queue) {
+				try {
+					result.set_value(co_await t);
+				}
+				catch (...) {
+					result.set_exception(std::current_exception());
+				}
+				queue->complete();
+			}
+
+		}//!namespace details
+
+		/**
+		 * Blocks a calling thread until a task is done. The task runs on this very thread: I/O threads
+		 * only read pages and hand suspended lookups back, so it may block or sync_wait() again.
+		 * Throws std::logic_error on an I/O thread, i.e. from a coroutine not started by sync_wait().
+		 * */
+		template <typename R>
+		R sync_wait (task<R> t) {
+			details::check_not_io_thread();
+			auto const queue {std::make_shared<details::RunQueue>()};
+			details::RunQueueScope const scope {queue};
+			std::promise<R> result;
+			auto future {result.get_future()};
+			queue->add_pending(1u);
+			details::run_detached(std::move(t), std::move(result), queue);
+			queue->run();
+			return future.get();
+		}
+
+		//starts all the tasks before waiting for any, so their I/O overlaps, results keep the order of tasks
+		template <typename R>
+		std::vector<R> sync_wait (std::vector<task<R>> tasks) {
+			details::check_not_io_thread();
+			auto const queue {std::make_shared<details::RunQueue>()};
+			details::RunQueueScope const scope {queue};
+			std::vector<std::future<R>> futures;
+			futures.reserve(tasks.size());
+			queue->add_pending(tasks.size());
+			for (auto& t : tasks) {
+				std::promise<R> result;
+				futures.push_back(result.get_future());
+				details::run_detached(std::move(t), std::move(result), queue);
+			}
+			queue->run();
+			std::vector<R> res;
+			res.reserve(futures.size());
+			for (auto& future : futures) res.push_back(future.get());
+			return res;
+		}
+
+		namespace details {
+
+			class IoPool final {
+			public:
+				explicit IoPool (std::size_t threads_count) {
+					threads.reserve(std::max<std::size_t>(threads_count, 1u));
+					for (std::size_t i = 0; i != std::max<std::size_t>(threads_count, 1u); ++i) {
+						threads.emplace_back([this]{ run_(); });
+					}
+				}
+
+				IoPool (IoPool const&) = delete;
+				IoPool& operator= (IoPool const&) = delete;
+
+				//jobs already submitted are done before threads are stopped
+				~IoPool () {
+					{
+						std::lock_guard const lock {mutex};
+						is_stopping = true;
+					}
+					cv.notify_all();
+					for (auto& thread : threads) thread.join();
+				}
+
+				void submit (std::function<void()> job) {
+					{
+						std::lock_guard const lock {mutex};
+						jobs.push_back(std::move(job));
+					}
+					cv.notify_one();
+				}
+
+			private:
+				std::mutex mutex;
+				std::condition_variable cv;
+				std::deque<std::function<void()>> jobs;
+				bool is_stopping {false};
+				std::vector<std::thread> threads;
+
+				void run_ () {
+					is_io_thread = true;
+					for (;;) {
+						std::function<void()> job;
+						{
+							std::unique_lock lock {mutex};
+							cv.wait(lock, [this]{ return is_stopping || !jobs.empty(); });
+							if (jobs.empty()) return;
+							job = std::move(jobs.front());
+							jobs.pop_front();
+						}
+						job();
+					}
+				}
+			};
+
+			//not thread safe, an owner guards it
+			template <typename Key, typename Value>
+			class LruCache final {
+			public:
+				explicit LruCache (std::size_t capacity) : capacity (std::max<std::size_t>(capacity, 1u))
+				{}
+
+				Value const* find (Key const& key) {
+					auto const it {index.find(key)};
+					if (it == index.end()) return nullptr;
+					items.splice(items.begin(), items, it->second);
+					return &it->second->second;
+				}
+
+				void insert (Key const& key, Value value) {
+					if (auto const it {index.find(key)}; it != index.end()) {
+						it->second->second = std::move(value);
+						items.splice(items.begin(), items, it->second);
+						return;
+					}
+					items.emplace_front(key, std::move(value));
+					index.emplace(key, items.begin());
+					if (items.size() > capacity) {
+						index.erase(items.back().first);
+						items.pop_back();
+					}
+				}
+
+				std::size_t size () const noexcept {
+					return items.size();
+				}
+
+			private:
+				using items_t = std::list<std::pair<Key, Value>>;
+
+				std::size_t capacity;
+				items_t items;
+				std::unordered_map<Key, typename items_t::iterator> index;
+			};
+
+			/**
+			 * Read-only trie stored in a file, for dictionaries that do not fit in memory.
+			 * Nodes are laid out as in FrozenTrie, blocks of subtrees are cut into pages, so a lookup
+			 * reads about one page per a few levels. Pages are kept in an LRU cache; a lookup is a coroutine,
+			 * which goes on at once on a cached page and otherwise suspends until an I/O thread reads it.
+			 * A lookup is then resumed by the thread waiting in sync_wait() for it; a lookup awaited by a
+			 * coroutine started some other way goes on on an I/O thread, and what follows it must not block.
+			 * Concurrent misses on the same page share one read.
+			 * Pages every lookup starts with are pinned and read lock free, the rest of a cache
+			 * is split into shards by page id, each an LRU under its own lock.
+			 * A file is in native byte order, written for the same alphabet by write() from a Trie, which has
+			 * to fit in memory together with its layout, or by write_sorted() from sorted keys, which streams
+			 * pages out and keeps only one key's path in memory, so a dictionary of any size can be written.
+			 * All lookups must be done before a trie is destroyed.
+			 * */
+			template<typename T, typename GetIndex, std::size_t abc_size = 26u>
+			requires requirements::conversion::CallableToIndex<GetIndex, T>
+			class PagedTrie final {
+			public:
+				using value_type = T;
+				using trie_type = Trie<T, GetIndex, abc_size>;
+				static constexpr std::size_t k_abc_size {abc_size};
+				static constexpr std::size_t k_page_size {4096u};
+
+			private:
+				using index_t = std::uint32_t;
+				using node_t = packed_node<abc_size>;
+				using page_t = std::vector<node_t>;
+				using page_ptr = std::shared_ptr<page_t const>;
+
+				static_assert(std::is_trivially_copyable_v<node_t>);
+				static constexpr std::size_t k_nodes_per_page {k_page_size / sizeof(node_t)};
+				static constexpr std::size_t k_cache_shards {16u};
+				static constexpr std::size_t k_min_shard_pages {64u};
+
+				//the first page of a file, nodes start from the second one
+				struct header_t final {
+					std::array<char, 8u> magic;
+					std::uint64_t abc;
+					std::uint64_t page_size;
+					std::uint64_t node_size;
+					std::uint64_t nodes_count;
+				};
+				static constexpr std::array<char, 8u> k_magic {'T', 'R', 'I', 'E', 'P', 'G', '0', '1'};
+
+				struct Word {};
+				struct WholePrefix {};
+
+				struct page_awaiter;
+
+				//a lookup started by sync_wait() is resumed by its thread, any other one by an I/O thread
+				struct waiter_t final {
+					page_awaiter* awaiter;
+					std::coroutine_handle<> handle;
+					std::shared_ptr<RunQueue> run_queue;
+				};
+
+				//a cached page is held, so it can't be dropped from under a lookup, a pinned one needs no holding
+				struct page_ref_t final {
+					page_t const* nodes;
+					page_ptr hold;
+				};
+
+				struct page_awaiter final {
+					PagedTrie const* self;
+					index_t page_id;
+					page_t const* pinned {nullptr};
+					page_ptr page {};
+					int error {0};
+
+					bool await_ready () {
+						if ((pinned = self->pinned_(page_id)) != nullptr) return true;
+						page = self->cached_(page_id);
+						return page != nullptr;
+					}
+					bool await_suspend (std::coroutine_handle<> handle) {
+						return self->request_(page_id, this, handle);
+					}
+					page_ref_t await_resume () {
+						if (error != 0) throw std::system_error(error, std::generic_category(), "paged trie: page read failed");
+						if (pinned != nullptr) return {pinned, {}};
+						page_t const* const nodes {page.get()};
+						return {nodes, std::move(page)};
+					}
+				};
+
+				struct alignas(k_cache_line_size) cache_shard_t final {
+					std::mutex mutex;
+					LruCache<index_t, page_ptr> cache;
+					std::unordered_map<index_t, std::vector<waiter_t>> in_flight;
+
+					explicit cache_shard_t (std::size_t capacity) : cache (capacity)
+					{}
+				};
+
+				//a node waiting for its siblings, so they are all written as one block
+				struct frame_t final {
+					bool is_leaf {false};
+					std::vector<std::pair<std::size_t, node_t>> children;
+				};
+
+				//nodes are appended page by page, a header goes to the first page once a count is known
+				class page_writer_t final {
+				public:
+					explicit page_writer_t (std::filesystem::path const& p)
+							: path (p)
+							, out (p, std::ios::binary | std::ios::trunc)
+							, buffer (k_page_size, 0)
+					{
+						if (!out) throw std::system_error(errno, std::generic_category(), path.string());
+						out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+					}
+
+					index_t emit (node_t const& node) {
+						if (count == std::numeric_limits<index_t>::max()) throw std::length_error("paged trie: too many nodes");
+						std::memcpy(buffer.data() + (count % k_nodes_per_page) * sizeof(node_t), &node, sizeof(node_t));
+						if (++count % k_nodes_per_page == 0u) flush_();
+						return static_cast<index_t>(count - 1u);
+					}
+
+					//a root is node 0, either emitted first or reserved by an empty node and given here
+					void finish (std::optional<node_t> const& root) {
+						if (count % k_nodes_per_page != 0u) flush_();
+						if (root) {
+							out.seekp(static_cast<std::streamoff>(k_page_size));
+							out.write(reinterpret_cast<char const*>(&*root), sizeof(node_t));
+						}
+						header_t const header {k_magic, abc_size, k_page_size, sizeof(node_t), count};
+						std::memcpy(buffer.data(), &header, sizeof(header));
+						out.seekp(0);
+						out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+						out.flush();
+						if (!out) throw std::system_error(errno != 0 ? errno : EIO, std::generic_category(), path.string());
+					}
+
+				private:
+					std::filesystem::path path;
+					std::ofstream out;
+					std::vector<char> buffer;
+					std::uint64_t count {0u};
+
+					void flush_ () {
+						out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+						std::fill(buffer.begin(), buffer.end(), 0);
+					}
+				};
+
+				struct file_t final {
+					int fd {-1};
+					file_t () = default;
+					file_t (file_t const&) = delete;
+					file_t& operator= (file_t const&) = delete;
+					~file_t () {
+						if (fd != -1) ::close(fd);
+					}
+				};
+
+			public:
+
+				//throws std::system_error if a file can't be opened or read, std::runtime_error if it's not a trie of this type
+				explicit PagedTrie (std::filesystem::path const& path, paged_options options = {})
+						: pool (options.io_threads)
+				{
+					file.fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+					if (file.fd == -1) throw std::system_error(errno, std::generic_category(), path.string());
+					header_t header;
+					if (::pread(file.fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+						throw std::system_error(errno != 0 ? errno : EIO, std::generic_category(), path.string());
+					}
+					if (header.magic != k_magic || header.abc != abc_size || header.page_size != k_page_size ||
+					    header.node_size != sizeof(node_t) || header.nodes_count == 0u) {
+						throw std::runtime_error("not a paged trie of this alphabet: " + path.string());
+					}
+					nodes = header.nodes_count;
+
+					//a shard is big enough for LRU to work, so a small cache is a single exact LRU
+					std::size_t const shards_count {std::clamp<std::size_t>(options.cache_pages / k_min_shard_pages, 1u, k_cache_shards)};
+					for (std::size_t i = 0; i != shards_count; ++i) {
+						shards.emplace_back((options.cache_pages + shards_count - 1u) / shards_count);
+					}
+					pin_(options.pinned_pages);
+				}
+
+				PagedTrie (PagedTrie const&) = delete;
+				PagedTrie& operator= (PagedTrie const&) = delete;
+
+				//lays a trie out and writes it to a file, throws std::system_error on failure
+				static void write (trie_type const& trie, std::filesystem::path const& path) {
+					auto const layout {relayout(trie, relayout_options{node_order::blocked, k_nodes_per_page, false}, {})};
+					page_writer_t out (path);
+					for (std::size_t pos = 0; pos != layout.order.size(); ++pos) {
+						out.emit(node_t::pack(layout.order[pos], layout.first_child[pos]));
+					}
+					out.finish(std::nullopt);
+				}
+
+				/**
+				 * Writes keys sorted by indexes of their symbols, e.g. lower case words sorted as strings,
+				 * duplicates allowed. A subtree is written once the keys have moved past it, its children
+				 * as one block after their own subtrees, so memory holds only the current key's path.
+				 * A key is cut at the first symbol out of an alphabet, as Trie::insert() does.
+				 * Throws std::invalid_argument if keys are not sorted, std::system_error on I/O failure.
+				 * */
+				template <typename Keys>
+				requires std::ranges::input_range<Keys> &&
+				         requirements::containers::IsRangeOfT<std::ranges::range_value_t<Keys>, T>
+				static void write_sorted (Keys&& keys, std::filesystem::path const& path) {
+					GetIndex const get_idx {};
+					page_writer_t out (path);
+					out.emit(node_t{});
+
+					std::vector<frame_t> frames (1u);
+					std::vector<std::size_t> key_path, symbols;
+					auto const close_last = [&]{
+						node_t const node {close_(out, frames.back())};
+						frames.pop_back();
+						frames.back().children.emplace_back(key_path.back(), node);
+						key_path.pop_back();
+					};
+
+					for (auto&& key : keys) {
+						symbols.clear();
+						bool is_empty {true};
+						for (auto const& t : key) {
+							is_empty = false;
+							auto const idx {index_of<abc_size>(get_idx, t)};
+							if (!idx) break;
+							symbols.push_back(idx.value());
+						}
+						if (is_empty) continue;
+
+						std::size_t lcp {0u};
+						while (lcp != symbols.size() && lcp != key_path.size() && symbols[lcp] == key_path[lcp]) ++lcp;
+						bool const is_sorted {lcp == key_path.size() || (lcp != symbols.size() && symbols[lcp] > key_path[lcp])};
+						if (!is_sorted) throw std::invalid_argument("paged trie: keys are not sorted");
+
+						while (key_path.size() != lcp) close_last();
+						for (std::size_t i = lcp; i != symbols.size(); ++i) {
+							frames.emplace_back();
+							key_path.push_back(symbols[i]);
+						}
+						frames.back().is_leaf = true;
+					}
+					while (!key_path.empty()) close_last();
+					out.finish(close_(out, frames.back()));
+				}
+
+				std::size_t nodes_count () const noexcept {
+					return nodes;
+				}
+
+				//pages read from disk so far, cache hits and shared reads are not counted
+				std::size_t pages_read () const noexcept {
+					return reads.load(std::memory_order_relaxed);
+				}
+
+				//a key is copied, so it may go out of scope before a task is awaited
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				task<bool> find_word_async (Range&& word) const {
+					return find_word_async(std::ranges::begin(word), std::ranges::end(word));
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				task<bool> find_word_async (Iter first, Sent last) const {
+					return find_<Word>(copy_(std::move(first), std::move(last)));
+				}
+
+				task<bool> find_word_async (T const* c_str) const
+				requires requirements::characters::IsCharacter<T> {
+					return find_word_async(c_str, null_terminated);
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				task<bool> is_prefix_async (Range&& prefix) const {
+					return is_prefix_async(std::ranges::begin(prefix), std::ranges::end(prefix));
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				task<bool> is_prefix_async (Iter first, Sent last) const {
+					return find_<WholePrefix>(copy_(std::move(first), std::move(last)));
+				}
+
+				task<bool> is_prefix_async (T const* c_str) const
+				requires requirements::characters::IsCharacter<T> {
+					return is_prefix_async(c_str, null_terminated);
+				}
+
+			private:
+				file_t file;
+				std::size_t nodes {0u};
+				GetIndex get_idx;
+				mutable std::atomic<std::size_t> reads {0u};
+				//filled once on opening, only read afterwards
+				std::unordered_map<index_t, page_ptr> pinned;
+				mutable std::deque<cache_shard_t> shards;
+				//the last one, so I/O threads are joined before anything they use is destroyed
+				mutable IoPool pool;
+
+			private:
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				static std::vector<T> copy_ (Iter first, Sent last) {
+					std::vector<T> res;
+					for (; first != last; ++first) res.push_back(*first);
+					return res;
+				}
+
+				//children of a frame come in ascending order of symbols, as ranks in a mask expect
+				static node_t close_ (page_writer_t& out, frame_t const& frame) {
+					node_t node {};
+					node.is_leaf = frame.is_leaf;
+					for (std::size_t i = 0; i != frame.children.size(); ++i) {
+						auto const& [symbol, child] {frame.children[i]};
+						index_t const pos {out.emit(child)};
+						if (i == 0u) node.first_child = pos;
+						node.mask[symbol / 64u] |= std::uint64_t{1u} << (symbol % 64u);
+					}
+					return node;
+				}
+
+				//0 on success, errno otherwise
+				int read_page_ (index_t page_id, page_t& page) const noexcept {
+					std::size_t const size {k_nodes_per_page * sizeof(node_t)};
+					off_t const offset {static_cast<off_t>((std::uint64_t{page_id} + 1u) * k_page_size)};
+					reads.fetch_add(1u, std::memory_order_relaxed);
+					if (::pread(file.fd, page.data(), size, offset) != static_cast<ssize_t>(size)) {
+						return errno != 0 ? errno : EIO;
+					}
+					return 0;
+				}
+
+				//pages are taken breadth first from a root, so the top levels every lookup passes are pinned
+				void pin_ (std::size_t pages_count) {
+					std::deque<index_t> queue {0u};
+					while (!queue.empty()) {
+						index_t const node {queue.front()};
+						queue.pop_front();
+						index_t const page_id {static_cast<index_t>(node / k_nodes_per_page)};
+						auto it {pinned.find(page_id)};
+						if (it == pinned.end()) {
+							if (pinned.size() == pages_count) break;
+							auto page {std::make_shared<page_t>(k_nodes_per_page)};
+							if (int const error {read_page_(page_id, *page)}; error != 0) {
+								throw std::system_error(error, std::generic_category(), "paged trie: page read failed");
+							}
+							it = pinned.emplace(page_id, std::move(page)).first;
+						}
+						node_t const& n {(*it->second)[node % k_nodes_per_page]};
+						std::size_t children {0u};
+						for (auto const word : n.mask) children += static_cast<std::size_t>(std::popcount(word));
+						for (std::size_t i = 0; i != children; ++i) {
+							if (n.first_child + i < nodes) queue.push_back(static_cast<index_t>(n.first_child + i));
+						}
+					}
+				}
+
+				page_t const* pinned_ (index_t page_id) const noexcept {
+					auto const it {pinned.find(page_id)};
+					return it == pinned.end() ? nullptr : it->second.get();
+				}
+
+				cache_shard_t& shard_ (index_t page_id) const noexcept {
+					return shards[page_id % shards.size()];
+				}
+
+				page_ptr cached_ (index_t page_id) const {
+					auto& shard {shard_(page_id)};
+					std::lock_guard const lock {shard.mutex};
+					auto const* page {shard.cache.find(page_id)};
+					return page ? *page : page_ptr{};
+				}
+
+				//false if a page got cached meanwhile, then a coroutine goes on at once
+				bool request_ (index_t page_id, page_awaiter* awaiter, std::coroutine_handle<> handle) const {
+					{
+						auto& shard {shard_(page_id)};
+						std::lock_guard const lock {shard.mutex};
+						if (auto const* page {shard.cache.find(page_id)}) {
+							awaiter->page = *page;
+							return false;
+						}
+						auto const [it, is_new] {shard.in_flight.try_emplace(page_id)};
+						it->second.push_back(waiter_t{awaiter, handle, current_run_queue});
+						if (!is_new) return true;
+					}
+					//a coroutine may be resumed and gone as soon as a read is submitted, nothing of it is touched after
+					pool.submit([this, page_id]{ read_(page_id); });
+					return true;
+				}
+
+				void read_ (index_t page_id) const {
+					auto page {std::make_shared<page_t>(k_nodes_per_page)};
+					int const error {read_page_(page_id, *page)};
+
+					std::vector<waiter_t> waiters;
+					{
+						auto& shard {shard_(page_id)};
+						std::lock_guard const lock {shard.mutex};
+						if (error == 0) shard.cache.insert(page_id, page);
+						auto const it {shard.in_flight.find(page_id)};
+						waiters = std::move(it->second);
+						shard.in_flight.erase(it);
+					}
+					for (auto const& waiter : waiters) {
+						if (error == 0) waiter.awaiter->page = page;
+						else waiter.awaiter->error = error;
+						if (waiter.run_queue) waiter.run_queue->post(waiter.handle);
+						else waiter.handle.resume();
+					}
+				}
+
+				page_awaiter load_ (index_t node) const noexcept {
+					return page_awaiter{this, static_cast<index_t>(node / k_nodes_per_page)};
+				}
+
+				template <typename FindMode>
+				task<bool> find_ (std::vector<T> key) const {
+					if (key.empty()) co_return false;
+					index_t node {0u}, page_id {0u};
+					page_ref_t page {co_await load_(node)};
+					for (auto const& t : key) {
+						auto const idx {index_of<abc_size>(get_idx, t)};
+						if (!idx) co_return false;
+						node = (*page.nodes)[node % k_nodes_per_page].child(idx.value());
+						if (node == 0u || node >= nodes) co_return false;
+						if (node / k_nodes_per_page != page_id) {
+							page_id = static_cast<index_t>(node / k_nodes_per_page);
+							page = co_await load_(node);
+						}
+					}
+					if constexpr (std::is_same_v<FindMode, Word>) {
+						co_return (*page.nodes)[node % k_nodes_per_page].is_leaf;
+					}
+					else if constexpr (std::is_same_v<FindMode, WholePrefix>) {
+						co_return true;
+					}
+					else {
+						static_assert(always_false_v<FindMode>, "Class was modified erroneously, check the changes made");
+						co_return false;
+					}
+				}
+			};
+
+		}//!namespace details
+
+		using paged_of_char = details::PagedTrie<char, details::GetIndex, 26u>;
+
+		template<typename T, typename GetIndexFunc, std::size_t ABCSize>
+		using paged = details::PagedTrie<T, GetIndexFunc, ABCSize>;
+
+	}//!namespace trie
+
+}//!namespace containers
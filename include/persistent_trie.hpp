@@ -0,0 +1,196 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include "trie.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <ranges>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <iterator>
+
+namespace containers {
+
+	namespace trie {
+
+		namespace details {
+
+			/**
+			 * Copy-on-write trie: snapshot() is O(1) and shares the whole structure, insert() copies
+			 * only the nodes on a path that are shared with some snapshot, so memory is spent in
+			 * proportion to the changes made after a snapshot was taken.
+			 * A snapshot never changes and may be read from any number of threads while a builder keeps
+			 * inserting, provided snapshots are taken by the builder's thread.
+			 * A node is written in place only if it is tagged with a trie's generation, and every copy
+			 * gives both tries new generations, so nodes shared with a snapshot, alive or dropped,
+			 * are never written, no matter what their reference counts are.
+			 * */
+			template<typename T, typename GetIndex, std::size_t abc_size = 26u>
+			requires requirements::conversion::CallableToIndex<GetIndex, T>
+			class PersistentTrie final : public TrieLookup<PersistentTrie<T, GetIndex, abc_size>, T, GetIndex, abc_size> {
+			public:
+				using value_type = T;
+				static constexpr std::size_t k_abc_size {abc_size};
+
+			private:
+
+				struct node_t final {
+					std::vector<std::shared_ptr<node_t>> next_level;
+					std::uint64_t generation;
+					bool is_leaf;
+
+					node_t() : generation(0u), is_leaf(false) {}
+				};
+
+				friend TrieLookup<PersistentTrie, T, GetIndex, abc_size>;
+
+			public:
+
+				PersistentTrie () : root (std::make_shared<node_t>())
+				{}
+
+				template <typename Container>
+				requires requirements::containers::IsContainerOfT<Container, T>
+				PersistentTrie (Container const& c) : root (std::make_shared<node_t>())
+				{
+					insert(c);
+				}
+
+				//a copy is a snapshot, it is O(1), from now on neither trie writes to nodes they share
+				PersistentTrie (PersistentTrie const& other)
+						: root (other.root)
+						, generation (next_generation_())
+				{
+					other.generation.store(next_generation_(), std::memory_order_relaxed);
+				}
+
+				PersistentTrie& operator= (PersistentTrie const& other) {
+					if (this != &other) {
+						root = other.root;
+						generation.store(next_generation_(), std::memory_order_relaxed);
+						other.generation.store(next_generation_(), std::memory_order_relaxed);
+					}
+					return *this;
+				}
+
+				//O(1), a moved-from trie is a valid empty one
+				PersistentTrie (PersistentTrie&& other) noexcept
+						: root (std::exchange(other.root, empty_root_()))
+						, generation (other.generation.exchange(next_generation_(), std::memory_order_relaxed))
+				{}
+
+				PersistentTrie& operator= (PersistentTrie&& other) noexcept {
+					if (this != &other) {
+						root = std::exchange(other.root, empty_root_());
+						generation.store(other.generation.exchange(next_generation_(), std::memory_order_relaxed), std::memory_order_relaxed);
+					}
+					return *this;
+				}
+
+				PersistentTrie snapshot () const noexcept {
+					return *this;
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				void insert (Range&& r) {
+					insert(std::ranges::begin(r), std::ranges::end(r));
+				}
+
+				template <std::forward_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				void insert (Iter first, Sent last) {
+					//a key already there must not cost a copied path
+					if (this->find_word(first, last)) return;
+					insert_(std::move(first), std::move(last));
+				}
+
+				void insert (T const* c_str)
+				requires requirements::characters::IsCharacter<T> {
+					insert(c_str, null_terminated);
+				}
+
+				//true if both tries share the very same structure, i.e. nothing was inserted since a snapshot
+				bool shares_root_with (PersistentTrie const& other) const noexcept {
+					return root == other.root;
+				}
+
+			private:
+				std::shared_ptr<node_t> root;
+				//atomic, as a snapshot may be copied from several threads at once
+				mutable std::atomic<std::uint64_t> generation {next_generation_()};
+
+			private:
+
+				//unique for every trie and every copy, 0 is never given out, so a shared empty root is never written
+				static std::uint64_t next_generation_ () noexcept {
+					static std::atomic<std::uint64_t> last {0u};
+					return last.fetch_add(1u, std::memory_order_relaxed) + 1u;
+				}
+
+				//moved-from tries share one empty root, so a move allocates nothing
+				static std::shared_ptr<node_t> empty_root_ () noexcept {
+					static std::shared_ptr<node_t> const empty {std::make_shared<node_t>()};
+					return empty;
+				}
+
+				//a node of another generation may be reachable from a snapshot, so it is replaced with a private copy first
+				node_t& own_ (std::shared_ptr<node_t>& node) {
+					std::uint64_t const current {generation.load(std::memory_order_relaxed)};
+					if (!node) {
+						node = std::make_shared<node_t>();
+						node->generation = current;
+					}
+					else if (node->generation != current) {
+						node = std::make_shared<node_t>(*node);
+						node->generation = current;
+					}
+					return *node;
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				void insert_ (Iter first, Sent last) {
+					node_t *node {&own_(root)};
+					for (auto it = std::move(first); it != last; ++it) {
+						auto const idx {index_of<abc_size>(this->get_idx, *it)};
+						if (!idx) break;
+						std::size_t const curr_idx {idx.value()};
+						if (node->next_level.size() <= curr_idx) {
+							node->next_level.resize(curr_idx + 1);
+						}
+						node = &own_(node->next_level[curr_idx]);
+					}
+					node->is_leaf = true;
+				}
+
+				node_t const* lookup_root_ () const noexcept {
+					return root.get();
+				}
+
+				static node_t const* lookup_child_ (node_t const* node, std::size_t idx) noexcept {
+					return idx < node->next_level.size() ? node->next_level[idx].get() : nullptr;
+				}
+
+				static bool lookup_is_leaf_ (node_t const* node) noexcept {
+					return node->is_leaf;
+				}
+			};
+
+		}//!namespace details
+
+		using persistent_of_char = details::PersistentTrie<char, details::GetIndex, 26u>;
+
+		template<typename T, typename GetIndexFunc, std::size_t ABCSize>
+		using persistent = details::PersistentTrie<T, GetIndexFunc, ABCSize>;
+
+	}//!namespace trie
+
+}//!namespace containers
@@ -0,0 +1,186 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include "trie.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <ranges>
+#include <array>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+#include <iterator>
+
+namespace containers {
+
+	namespace trie {
+
+		namespace details {
+
+			/**
+			 * Trie split into independently locked shards, for many threads mixing reads and inserts.
+			 * A key goes to a shard by a hash of its first prefix_len symbols, so all the keys sharing
+			 * these symbols live in one shard and most of the queries take a single shared lock.
+			 * Only a prefix shorter than prefix_len has to visit every shard.
+			 * Symbols are hashed by their trie indexes, i.e. keys equal for a trie share a shard as well.
+			 * */
+			template<typename T, typename GetIndex, std::size_t abc_size = 26u,
+			         std::size_t shards_count = 64u, std::size_t prefix_len = 2u>
+			requires requirements::conversion::CallableToIndex<GetIndex, T> &&
+			         (shards_count > 0u) && (prefix_len > 0u)
+			class ShardedTrie final {
+			public:
+				using value_type = T;
+				using trie_type = Trie<T, GetIndex, abc_size>;
+				static constexpr std::size_t k_abc_size {abc_size};
+				static constexpr std::size_t k_shards_count {shards_count};
+				static constexpr std::size_t k_prefix_len {prefix_len};
+
+			private:
+
+				//every shard starts a cache line of its own, so taking one lock never invalidates a neighbour's
+				struct alignas(k_cache_line_size) shard_t final {
+					mutable std::shared_mutex mutex;
+					trie_type trie;
+				};
+
+				struct home_t final {
+					std::size_t shard;
+					std::size_t hashed_len;
+				};
+
+			public:
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T> && std::ranges::forward_range<Range>
+				void insert (Range&& r) {
+					insert(std::ranges::begin(r), std::ranges::end(r));
+				}
+
+				template <std::forward_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				void insert (Iter first, Sent last) {
+					if (first == last) return;
+					auto& shard {shards[home_(first, last).shard]};
+					std::unique_lock const lock {shard.mutex};
+					shard.trie.insert(std::move(first), std::move(last));
+				}
+
+				void insert (T const* c_str)
+				requires requirements::characters::IsCharacter<T> {
+					insert(c_str, null_terminated);
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T> && std::ranges::forward_range<Range>
+				bool find_word (Range&& word) const {
+					return find_word(std::ranges::begin(word), std::ranges::end(word));
+				}
+
+				template <std::forward_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				bool find_word (Iter first, Sent last) const {
+					if (first == last) return false;
+					auto const& shard {shards[home_(first, last).shard]};
+					std::shared_lock const lock {shard.mutex};
+					return shard.trie.find_word(std::move(first), std::move(last));
+				}
+
+				bool find_word (T const* c_str) const
+				requires requirements::characters::IsCharacter<T> {
+					return find_word(c_str, null_terminated);
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T> && std::ranges::forward_range<Range>
+				bool is_prefix (Range&& prefix) const {
+					return is_prefix(std::ranges::begin(prefix), std::ranges::end(prefix));
+				}
+
+				template <std::forward_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				bool is_prefix (Iter first, Sent last) const {
+					if (first == last) return false;
+					auto const home {home_(first, last)};
+					if (home.hashed_len == prefix_len) {
+						auto const& shard {shards[home.shard]};
+						std::shared_lock const lock {shard.mutex};
+						return shard.trie.is_prefix(std::move(first), std::move(last));
+					}
+					for (auto const& shard : shards) {
+						std::shared_lock const lock {shard.mutex};
+						if (shard.trie.is_prefix(first, last)) return true;
+					}
+					return false;
+				}
+
+				bool is_prefix (T const* c_str) const
+				requires requirements::characters::IsCharacter<T> {
+					return is_prefix(c_str, null_terminated);
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T> && std::ranges::forward_range<Range>
+				std::vector<T> find_prefix (Range&& prefix) const {
+					return find_prefix(std::ranges::begin(prefix), std::ranges::end(prefix));
+				}
+
+				//a home shard answers as soon as it matches prefix_len symbols, otherwise every shard is asked
+				template <std::forward_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				std::vector<T> find_prefix (Iter first, Sent last) const {
+					if (first == last) return {};
+					std::vector<T> res;
+					{
+						auto const& shard {shards[home_(first, last).shard]};
+						std::shared_lock const lock {shard.mutex};
+						res = shard.trie.find_prefix(first, last);
+					}
+					if (res.size() >= prefix_len) return res;
+					for (auto const& shard : shards) {
+						std::shared_lock const lock {shard.mutex};
+						auto found {shard.trie.find_prefix(first, last)};
+						if (found.size() > res.size()) res = std::move(found);
+					}
+					return res;
+				}
+
+				std::vector<T> find_prefix (T const* c_str) const
+				requires requirements::characters::IsCharacter<T> {
+					return find_prefix(c_str, null_terminated);
+				}
+
+			private:
+				std::array<shard_t, shards_count> shards;
+				GetIndex get_idx;
+
+			private:
+
+				//FNV-1a over the indexes of the first prefix_len symbols, stopping where a trie would stop
+				template <std::forward_iterator Iter, std::sentinel_for<Iter> Sent>
+				home_t home_ (Iter it, Sent last) const noexcept {
+					std::size_t hash {14695981039346656037ull}, len {0u};
+					for (; len != prefix_len && it != last; ++len, ++it) {
+						auto const idx {index_of<abc_size>(get_idx, *it)};
+						if (!idx) break;
+						hash = (hash ^ idx.value()) * 1099511628211ull;
+					}
+					return {hash % shards_count, len};
+				}
+			};
+
+		}//!namespace details
+
+		template<std::size_t ShardsCount = 64u, std::size_t PrefixLen = 2u>
+		using sharded_of_char = details::ShardedTrie<char, details::GetIndex, 26u, ShardsCount, PrefixLen>;
+
+		template<typename T, typename GetIndexFunc, std::size_t ABCSize, std::size_t ShardsCount = 64u, std::size_t PrefixLen = 2u>
+		using sharded = details::ShardedTrie<T, GetIndexFunc, ABCSize, ShardsCount, PrefixLen>;
+
+	}//!namespace trie
+
+}//!namespace containers
@@ -0,0 +1,256 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include "trie.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <cstdint>
+
+namespace containers {
+
+	namespace trie {
+
+		namespace details {
+
+			/**
+			 * Substring index over a corpus of documents: a generalized suffix automaton, built in time
+			 * linear in the corpus size. Every state keeps the ids of documents its substrings occur in
+			 * and the total number of occurrences, so both questions cost O(|P|) to find a state and
+			 * O(1) to answer, with a list of documents returned as a view of occ ids.
+			 * Symbols out of an alphabet split a document, no substring spans them.
+			 * Index is immutable once built, so it can be shared by any number of readers.
+			 * */
+			template<typename T, typename GetIndex, std::size_t abc_size = 26u>
+			requires requirements::conversion::CallableToIndex<GetIndex, T>
+			class SuffixIndex final {
+			public:
+				using value_type = T;
+				using doc_id_type = std::uint32_t;
+				static constexpr std::size_t k_abc_size {abc_size};
+
+			private:
+				using index_t = std::uint32_t;
+
+				static constexpr index_t k_no_link {std::numeric_limits<index_t>::max()};
+
+				//next[c] is 0 where an automaton has no transition, none of them leads back to a start state
+				struct state_t final {
+					std::vector<index_t> next;
+					index_t link {k_no_link};
+					index_t len {0u};
+				};
+
+			public:
+
+				SuffixIndex () : states (1u), occurrences (1u, 0u), docs_offsets (2u, 0u)
+				{}
+
+				template <typename Documents>
+				requires std::ranges::forward_range<Documents> &&
+				         std::ranges::forward_range<std::ranges::range_value_t<Documents>> &&
+				         requirements::containers::IsRangeOfT<std::ranges::range_value_t<Documents>, T>
+				explicit SuffixIndex (Documents const& documents) : states (1u)
+				{
+					for (auto const& document : documents) {
+						index_t last {0u};
+						for (auto const& t : document) {
+							auto const idx {index_of<abc_size>(get_idx, t)};
+							last = idx ? extend_(last, idx.value()) : 0u;
+						}
+						++docs_count;
+					}
+					collect_(documents);
+				}
+
+				std::size_t documents_count () const noexcept {
+					return docs_count;
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				bool contains (Range&& pattern) const noexcept {
+					return find_(std::ranges::begin(pattern), std::ranges::end(pattern)) != 0u;
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				bool contains (Iter first, Sent last) const noexcept {
+					return find_(std::move(first), std::move(last)) != 0u;
+				}
+
+				//number of occurrences in all the documents, overlapping ones included
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				std::size_t count (Range&& pattern) const noexcept {
+					return occurrences[find_(std::ranges::begin(pattern), std::ranges::end(pattern))];
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				std::size_t count (Iter first, Sent last) const noexcept {
+					return occurrences[find_(std::move(first), std::move(last))];
+				}
+
+				//ids of documents containing a pattern, in ascending order, an id is a position in a corpus
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				std::span<doc_id_type const> documents (Range&& pattern) const noexcept {
+					return documents_of_(find_(std::ranges::begin(pattern), std::ranges::end(pattern)));
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				std::span<doc_id_type const> documents (Iter first, Sent last) const noexcept {
+					return documents_of_(find_(std::move(first), std::move(last)));
+				}
+
+			private:
+				std::vector<state_t> states;
+				std::vector<std::size_t> occurrences;
+				std::vector<std::size_t> docs_offsets;
+				std::vector<doc_id_type> docs;
+				std::size_t docs_count {0u};
+				GetIndex get_idx;
+
+			private:
+
+				index_t transition_ (index_t state, std::size_t c) const noexcept {
+					auto const& next {states[state].next};
+					return c < next.size() ? next[c] : 0u;
+				}
+
+				void set_transition_ (index_t state, std::size_t c, index_t target) {
+					auto& next {states[state].next};
+					if (next.size() <= c) next.resize(c + 1);
+					next[c] = target;
+				}
+
+				index_t new_state_ (state_t state) {
+					index_t const res {static_cast<index_t>(states.size())};
+					states.push_back(std::move(state));
+					return res;
+				}
+
+				//q is split so that a clone holds strings up to len(p) + 1, transitions to q are redirected
+				index_t clone_ (index_t p, index_t q, std::size_t c) {
+					index_t const clone {new_state_(states[q])};
+					states[clone].len = states[p].len + 1u;
+					for (; p != k_no_link && transition_(p, c) == q; p = states[p].link) {
+						set_transition_(p, c, clone);
+					}
+					states[q].link = clone;
+					return clone;
+				}
+
+				//returns a state for the longest string a document has ended with after c
+				index_t extend_ (index_t last, std::size_t c) {
+					//the same string was already seen in another document
+					if (index_t const q {transition_(last, c)}; q != 0u) {
+						return states[last].len + 1u == states[q].len ? q : clone_(last, q, c);
+					}
+					index_t const cur {new_state_(state_t{{}, k_no_link, states[last].len + 1u})};
+					index_t p {last};
+					for (; p != k_no_link && transition_(p, c) == 0u; p = states[p].link) {
+						set_transition_(p, c, cur);
+					}
+					if (p == k_no_link) {
+						states[cur].link = 0u;
+					}
+					else if (index_t const q {transition_(p, c)}; states[p].len + 1u == states[q].len) {
+						states[cur].link = q;
+					}
+					else {
+						states[cur].link = clone_(p, q, c);
+					}
+					return cur;
+				}
+
+				/**
+				 * Second pass over a corpus, once the automaton is final. Every prefix of a document marks
+				 * its state and all the states up its suffix links, stopping at the first one already marked
+				 * by the same document, so every (state, document) pair is recorded exactly once.
+				 * */
+				template <typename Documents>
+				void collect_ (Documents const& documents) {
+					occurrences.assign(states.size(), 0u);
+					std::vector<doc_id_type> last_doc (states.size(), std::numeric_limits<doc_id_type>::max());
+					std::vector<std::size_t> docs_per_state (states.size(), 0u);
+					std::vector<std::pair<index_t, doc_id_type>> marks;
+
+					doc_id_type doc {0u};
+					for (auto const& document : documents) {
+						index_t state {0u};
+						for (auto const& t : document) {
+							auto const idx {index_of<abc_size>(get_idx, t)};
+							if (!idx) {
+								state = 0u;
+								continue;
+							}
+							state = transition_(state, idx.value());
+							++occurrences[state];
+							for (index_t s = state; s != 0u && last_doc[s] != doc; s = states[s].link) {
+								last_doc[s] = doc;
+								++docs_per_state[s];
+								marks.emplace_back(s, doc);
+							}
+						}
+						++doc;
+					}
+
+					//occurrences are summed up the suffix links, longer states first
+					std::vector<std::size_t> by_len_offsets (states.size() + 1u, 0u);
+					for (auto const& state : states) ++by_len_offsets[state.len + 1u];
+					for (std::size_t i = 1; i != by_len_offsets.size(); ++i) by_len_offsets[i] += by_len_offsets[i - 1];
+					std::vector<index_t> by_len (states.size());
+					for (index_t s = 0; s != states.size(); ++s) by_len[by_len_offsets[states[s].len]++] = s;
+					for (auto it = by_len.rbegin(); it != by_len.rend(); ++it) {
+						if (*it != 0u) occurrences[states[*it].link] += occurrences[*it];
+					}
+					occurrences[0] = 0u;
+
+					//marks come in ascending order of documents, a stable placement keeps it per state
+					docs_offsets.assign(states.size() + 1u, 0u);
+					for (std::size_t s = 0; s != states.size(); ++s) docs_offsets[s + 1u] = docs_offsets[s] + docs_per_state[s];
+					docs.resize(marks.size());
+					std::vector<std::size_t> fill (docs_offsets.begin(), docs_offsets.end() - 1);
+					for (auto const& [s, d] : marks) docs[fill[s]++] = d;
+				}
+
+				//0 stands for "not found", an empty pattern is not looked for, as everywhere in a trie
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				index_t find_ (Iter first, Sent last) const noexcept {
+					index_t state {0u};
+					for (auto it = std::move(first); it != last; ++it) {
+						auto const idx {index_of<abc_size>(get_idx, *it)};
+						if (!idx) return 0u;
+						state = transition_(state, idx.value());
+						if (state == 0u) return 0u;
+					}
+					return state;
+				}
+
+				std::span<doc_id_type const> documents_of_ (index_t state) const noexcept {
+					return {docs.data() + docs_offsets[state], docs_offsets[state + 1u] - docs_offsets[state]};
+				}
+			};
+
+		}//!namespace details
+
+		using suffix_index_of_char = details::SuffixIndex<char, details::GetIndex, 26u>;
+
+		template<typename T, typename GetIndexFunc, std::size_t ABCSize>
+		using suffix_index = details::SuffixIndex<T, GetIndexFunc, ABCSize>;
+
+	}//!namespace trie
+
+}//!namespace containers
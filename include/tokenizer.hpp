@@ -0,0 +1,294 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include "trie.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <span>
+#include <iterator>
+#include <istream>
+#include <cstdint>
+
+namespace containers {
+
+	namespace trie {
+
+		template <typename Payload>
+		struct token final {
+			std::size_t offset;
+			std::size_t length;
+			Payload payload;
+
+			bool operator== (token const&) const = default;
+		};
+
+		namespace details {
+
+			/**
+			 * Greedy longest-match tokenizer over a vocabulary.
+			 * Vocabulary lives in a flat trie with dense transitions, so every symbol of the input
+			 * costs one table lookup; a walk remembers the last leaf it passed and is never restarted
+			 * from the root before a token is emitted.
+			 * Symbols no vocabulary key starts with are skipped, such gaps are visible through token offsets.
+			 * */
+			template<typename T, typename GetIndex, std::size_t abc_size = 26u, typename Payload = std::size_t>
+			requires requirements::conversion::CallableToIndex<GetIndex, T> &&
+			         std::default_initializable<Payload> && std::copyable<Payload>
+			class Tokenizer final {
+			public:
+				using value_type = T;
+				using payload_type = Payload;
+				using token_type = token<Payload>;
+				static constexpr std::size_t k_abc_size {abc_size};
+
+			private:
+				using index_t = std::uint32_t;
+
+				/**
+				 * A transition is (child index << 2 | k_leaf | k_has_next), so a walk learns everything
+				 * about a child from its parent's cache line and touches a child only to step further.
+				 * An empty transition is 0, as in every trie kept in an array.
+				 * */
+				static constexpr index_t k_has_next {1u};
+				static constexpr index_t k_leaf {2u};
+				static constexpr index_t k_flags_bits {2u};
+
+				struct node_t final {
+					std::array<index_t, abc_size> next {};
+					Payload payload {};
+				};
+
+				struct walk_t final {
+					index_t node {0u};
+					index_t last_leaf {0u};
+					std::size_t last_len {0u};
+				};
+
+			public:
+
+				Tokenizer () : nodes (1u)
+				{}
+
+				//every key gets its position in a vocabulary as a payload
+				template <typename Vocabulary>
+				requires requirements::containers::IsContainer<Vocabulary> &&
+				         requirements::containers::IsContainerOfT<typename Vocabulary::value_type, T> &&
+				         std::constructible_from<Payload, std::size_t>
+				Tokenizer (Vocabulary const& vocabulary) : nodes (1u)
+				{
+					for (std::size_t id = 0; auto const& key : vocabulary) {
+						insert(key, Payload(id++));
+					}
+				}
+
+				//inserting a key once again overwrites its payload
+				template <typename Container>
+				requires requirements::containers::IsContainerOfT<Container, T>
+				void insert (Container const& key, Payload payload) {
+					if (key.empty()) return;
+					insert_(key.begin(), key.end(), std::move(payload));
+				}
+
+				template <std::input_iterator Iter>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				void insert (Iter first, Iter last, Payload payload) {
+					if (first == last) return;
+					insert_(first, last, std::move(payload));
+				}
+
+				//length of the longest key, no walk ever goes deeper than that
+				std::size_t max_key_length () const noexcept {
+					return max_len;
+				}
+
+				template <std::output_iterator<token_type> Out>
+				Out tokenize (std::span<T const> buffer, Out out) const {
+					walk_t walk;
+					std::size_t start {0u}, pos {0u};
+					scan_(buffer.data(), buffer.size(), 0u, start, pos, buffer.size(), true, walk, out);
+					return out;
+				}
+
+				template <std::output_iterator<token_type> Out>
+				requires std::same_as<T, char>
+				Out tokenize (std::istream& in, Out out, std::size_t chunk_size = 1u << 16) const {
+					Stream stream {*this};
+					std::vector<char> chunk (chunk_size);
+					while (in.read(chunk.data(), static_cast<std::streamsize>(chunk.size())) || in.gcount() > 0) {
+						out = stream.feed(std::span<char const>(chunk.data(), static_cast<std::size_t>(in.gcount())), out);
+					}
+					return stream.finish(out);
+				}
+
+				/**
+				 * Chunked input: feed() emits every token that is already decided, an unfinished walk is
+				 * carried over to the next chunk, finish() flushes it. Offsets are global across all the chunks.
+				 * Only a tail of at most max_key_length() symbols is ever copied.
+				 * Tokenizer must outlive its streams and must not be changed while they are in use.
+				 * */
+				class Stream final {
+				public:
+					explicit Stream (Tokenizer const& t) : tokenizer (&t)
+					{}
+
+					template <std::output_iterator<token_type> Out>
+					Out feed (std::span<T const> chunk, Out out) {
+						if (chunk.empty()) return out;
+						std::size_t const chunk_offset {offset};
+						offset += chunk.size();
+
+						std::size_t from {0u};
+						if (!pending.empty()) {
+							//a walk started in a carried tail can't go further than max_key_length() symbols into a chunk
+							std::size_t const carried {pending.size()};
+							std::size_t const take {std::min(chunk.size(), tokenizer->max_len)};
+							pending.insert(pending.end(), chunk.begin(), chunk.begin() + take);
+							tokenizer->scan_(pending.data(), pending.size(), base, start, pos, carried, false, walk, out);
+							if (start < carried) {
+								compact_();
+								return out;
+							}
+							from = start - carried;
+							pending.clear();
+							start = pos = 0u;
+						}
+
+						std::size_t s {from}, p {from};
+						tokenizer->scan_(chunk.data(), chunk.size(), chunk_offset, s, p, chunk.size(), false, walk, out);
+						if (s < chunk.size()) {
+							pending.assign(chunk.begin() + s, chunk.end());
+							base = chunk_offset + s;
+							start = 0u;
+							pos = p - s;
+						}
+						return out;
+					}
+
+					//flushes a carried walk, after that a stream starts over from offset 0
+					template <std::output_iterator<token_type> Out>
+					Out finish (Out out) {
+						tokenizer->scan_(pending.data(), pending.size(), base, start, pos, pending.size(), true, walk, out);
+						pending.clear();
+						base = offset = start = pos = 0u;
+						walk = walk_t{};
+						return out;
+					}
+
+				private:
+					Tokenizer const* tokenizer;
+					std::vector<T> pending;
+					std::size_t base {0u}, offset {0u}, start {0u}, pos {0u};
+					walk_t walk;
+
+					void compact_ () {
+						pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(start));
+						base += start;
+						pos -= start;
+						start = 0u;
+					}
+				};
+
+				Stream stream () const {
+					return Stream {*this};
+				}
+
+			private:
+				std::vector<node_t> nodes;
+				std::size_t max_len {0u};
+				GetIndex get_idx;
+
+			private:
+
+				index_t step (index_t node, T const& t) const noexcept {
+					auto const idx {index_of<abc_size>(get_idx, t)};
+					return idx ? nodes[node].next[idx.value()] : 0u;
+				}
+
+				template <std::input_iterator Iter>
+				void insert_ (Iter first, Iter last, Payload payload) {
+					index_t node {0u}, parent {0u};
+					std::size_t len {0u}, parent_idx {0u};
+					for (auto it = first; it != last; ++it, ++len) {
+						auto const found {index_of<abc_size>(get_idx, *it)};
+						if (!found) break;
+						std::size_t const idx {found.value()};
+						if (nodes[node].next[idx] == 0u) {
+							index_t const next {static_cast<index_t>(nodes.size())};
+							nodes.emplace_back();
+							nodes[node].next[idx] = next << k_flags_bits;
+							if (node != 0u) nodes[parent].next[parent_idx] |= k_has_next;
+						}
+						parent = node;
+						parent_idx = idx;
+						node = nodes[node].next[idx] >> k_flags_bits;
+					}
+					if (node == 0u) return;
+					nodes[parent].next[parent_idx] |= k_leaf;
+					nodes[node].payload = std::move(payload);
+					max_len = std::max(max_len, len);
+				}
+
+				//emits a token for the last leaf seen, or skips one symbol if there was none
+				template <typename Out>
+				void resolve_ (std::size_t base, std::size_t& start, std::size_t& pos, walk_t& walk, Out& out) const {
+					if (walk.last_leaf != 0u) {
+						*out++ = token_type{base + start, walk.last_len, nodes[walk.last_leaf].payload};
+						start += walk.last_len;
+					}
+					else {
+						++start;
+					}
+					pos = start;
+					walk = walk_t{};
+				}
+
+				/**
+				 * Walks data[pos, size) continuing a walk started at data[start].
+				 * Returns as soon as start reaches stop, or when input is over and more of it may come.
+				 * */
+				template <typename Out>
+				void scan_ (T const* data, std::size_t size, std::size_t base,
+				            std::size_t& start, std::size_t& pos, std::size_t stop,
+				            bool is_final, walk_t& walk, Out& out) const {
+					while (start < stop) {
+						if (pos == size) {
+							if (!is_final) return;
+							resolve_(base, start, pos, walk, out);
+							continue;
+						}
+						index_t const edge {step(walk.node, data[pos])};
+						if (edge == 0u) {
+							resolve_(base, start, pos, walk, out);
+							continue;
+						}
+						walk.node = edge >> k_flags_bits;
+						++pos;
+						if (edge & k_leaf) {
+							walk.last_leaf = walk.node;
+							walk.last_len = pos - start;
+						}
+						if (!(edge & k_has_next)) {
+							resolve_(base, start, pos, walk, out);
+						}
+					}
+				}
+			};
+
+		}//!namespace details
+
+		template<typename Payload = std::size_t>
+		using tokenizer_of_char = details::Tokenizer<char, details::GetIndex, 26u, Payload>;
+
+		template<typename T, typename GetIndexFunc, std::size_t ABCSize, typename Payload = std::size_t>
+		using tokenizer = details::Tokenizer<T, GetIndexFunc, ABCSize, Payload>;
+
+	}//!namespace trie
+
+}//!namespace containers
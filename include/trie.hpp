@@ -10,7 +10,12 @@
 #include <vector>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <iterator>
+#include <ranges>
+#include <algorithm>
+#include <future>
+#include <tuple>
 
 namespace requirements {
 
@@ -27,8 +32,24 @@ namespace requirements {
 		template<typename C, typename T>
 		concept IsContainerOfT = IsContainer<C> && std::same_as<typename C::value_type, T>;
 
+		//C arrays are left out, as a string literal is a range with its terminating zero included
+		template<typename R, typename T>
+		concept IsRangeOfT =
+				std::ranges::input_range<R> &&
+				!std::is_array_v<std::remove_cvref_t<R>> &&
+				std::same_as<std::ranges::range_value_t<R>, T>;
+
 	}//!namespace containers
 
+	namespace characters {
+
+		template<typename T>
+		concept IsCharacter =
+				std::same_as<T, char> || std::same_as<T, wchar_t> ||
+				std::same_as<T, char8_t> || std::same_as<T, char16_t> || std::same_as<T, char32_t>;
+
+	}//!namespace characters
+
 	namespace conversion {
 
 		template <typename Callable, typename... Args>
@@ -55,11 +76,150 @@ namespace containers {
 
 	namespace trie {
 
+		struct sequential_t {};
+		struct parallel_t {};
+		inline constexpr sequential_t sequential {};
+		inline constexpr parallel_t parallel {};
+
+		//sentinel of a zero terminated sequence, such as a C string
+		struct null_terminated_t {
+			template <typename T>
+			friend bool operator== (T const* p, null_terminated_t) noexcept {
+				return *p == T{};
+			}
+		};
+		inline constexpr null_terminated_t null_terminated {};
+
 		namespace details {
 
+			template <typename...>
+			inline constexpr bool always_false_v {false};
+
+			inline constexpr std::size_t k_cache_line_size {64u};
+
+			//index of a child for a symbol, none for a symbol out of an alphabet
+			template <std::size_t abc_size, typename GetIndex, typename T>
+			std::optional<std::size_t> index_of (GetIndex const& get_idx, T const& t) noexcept {
+				std::size_t idx {get_idx(t)};
+				return idx >= abc_size ? std::nullopt : std::optional<std::size_t>{idx};
+			}
+
+			/**
+			 * find_word(), find_prefix() and is_prefix() of a trie walked a symbol at a time from a root.
+			 * Derived gives lookup_root_(), lookup_child_(node, idx) and lookup_is_leaf_(node),
+			 * where a node is whatever it walks with and a missing child converts to false.
+			 * Tries keeping nodes in an array put a root at index 0; a root is nobody's child,
+			 * so here and in every such trie 0 means "no child".
+			 * */
+			template <typename Derived, typename T, typename GetIndex, std::size_t abc_size>
+			class TrieLookup {
+			public:
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				bool find_word(Range&& word) const noexcept {
+					return find_word(std::ranges::begin(word), std::ranges::end(word));
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				bool find_word(Iter first, Sent last) const noexcept {
+					return first != last && find_<Word>(std::move(first), std::move(last));
+				}
+
+				bool find_word(T const* c_str) const noexcept
+				requires requirements::characters::IsCharacter<T> {
+					return find_word(c_str, null_terminated);
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				std::vector<T> find_prefix(Range&& prefix) const noexcept {
+					return find_prefix(std::ranges::begin(prefix), std::ranges::end(prefix));
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				std::vector<T> find_prefix(Iter first, Sent last) const noexcept {
+					return first != last ? find_<Prefix>(std::move(first), std::move(last)) : std::vector<T>{};
+				}
+
+				std::vector<T> find_prefix(T const* c_str) const noexcept
+				requires requirements::characters::IsCharacter<T> {
+					return find_prefix(c_str, null_terminated);
+				}
+
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				bool is_prefix(Range&& prefix) const noexcept {
+					return is_prefix(std::ranges::begin(prefix), std::ranges::end(prefix));
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				requires std::same_as<typename std::iter_value_t<Iter>, T>
+				bool is_prefix(Iter first, Sent last) const noexcept {
+					return first != last && find_<WholePrefix>(std::move(first), std::move(last));
+				}
+
+				bool is_prefix(T const* c_str) const noexcept
+				requires requirements::characters::IsCharacter<T> {
+					return is_prefix(c_str, null_terminated);
+				}
+
+			protected:
+				GetIndex get_idx;
+
+			private:
+				struct Word {};
+				struct Prefix {};
+				struct WholePrefix {};
+
+				Derived const& derived_ () const noexcept {
+					return static_cast<Derived const&>(*this);
+				}
+
+				//only Prefix mode allocates, as it has to return a path found
+				template <typename FindMode, std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				auto find_(Iter first, Sent last) const noexcept {
+					bool is_found {true};
+					auto node {derived_().lookup_root_()};
+
+					[[maybe_unused]] std::vector<T> res;
+					if constexpr (std::is_same_v<FindMode, Prefix>) {
+						res.reserve(1 << 7);
+					}
+
+					for (auto it = std::move(first); it != last; ++it) {
+						T const t {*it};
+						auto const idx {index_of<abc_size>(get_idx, t)};
+						auto const next {idx ? derived_().lookup_child_(node, idx.value()) : decltype(node){}};
+						if (!next) {
+							is_found = false;
+							break;
+						}
+						if constexpr (std::is_same_v<FindMode, Prefix>) {
+							res.push_back(t);
+						}
+						node = next;
+					}
+					if constexpr (std::is_same_v<FindMode, Word>) {
+						return is_found && derived_().lookup_is_leaf_(node);
+					}
+					else if constexpr (std::is_same_v<FindMode, WholePrefix>) {
+						return is_found;
+					}
+					else if constexpr (std::is_same_v<FindMode, Prefix>) {
+						return res;
+					}
+					else {
+						static_assert(always_false_v<FindMode>, "Class was modified erroneously, check the changes made");
+						return 42;
+					}
+				}
+			};
+
 			template<typename T, typename GetIndex, std::size_t abc_size = 26u>
 			requires requirements::conversion::CallableToIndex<GetIndex, T>
-			class Trie final {
+			class Trie final : public TrieLookup<Trie<T, GetIndex, abc_size>, T, GetIndex, abc_size> {
 			public:
 				using value_type = T;
 				static constexpr std::size_t k_abc_size {abc_size};
@@ -71,89 +231,218 @@ namespace containers {
 					bool is_leaf;
 
 					node_t() : is_leaf(false) {}
+					node_t (node_t&&) noexcept = default;
+					node_t& operator= (node_t&&) noexcept = default;
+
+					//subtrees are released without recursion, as a key may be longer than a stack is deep
+					~node_t () {
+						std::vector<std::unique_ptr<node_t>> pending;
+						for (auto& next : next_level) {
+							if (next) pending.push_back(std::move(next));
+						}
+						while (!pending.empty()) {
+							auto node {std::move(pending.back())};
+							pending.pop_back();
+							for (auto& next : node->next_level) {
+								if (next) pending.push_back(std::move(next));
+							}
+						}
+					}
 				};
 
-				struct Word {};
-				struct Prefix {};
+				friend TrieLookup<Trie, T, GetIndex, abc_size>;
 
 			public:
 
-				Trie () : root (std::make_unique<node_t>())
-				{}
+				Trie () = default;
 
 				template <typename Container>
 				requires requirements::containers::IsContainerOfT<Container, T>
-				Trie (Container const& c) : root (std::make_unique<node_t>())
+				Trie (Container const& c)
 				{
 					insert(c);
 				}
 
-				template <typename Container>
-				requires requirements::containers::IsContainerOfT<Container, T>
-				void insert (Container const& c) const {
-					if (c.empty()) return;
-					insert_(c.begin(), c.end());
+				//copies are explicit, see clone()
+				Trie (Trie const&) = delete;
+				Trie& operator= (Trie const&) = delete;
+
+				//O(1), a moved-from trie is a valid empty one
+				Trie (Trie&& other) noexcept
+						: root (std::move(other.root))
+				{
+					other.clear();
 				}
 
-				template <std::input_iterator Iter>
-				requires std::same_as<typename std::iter_value_t<Iter>, T>
-				void insert (Iter first, Iter last) const {
-					if (first >= last) return;
-					insert_(first, last);
+				Trie& operator= (Trie&& other) noexcept {
+					if (this != &other) {
+						root = std::move(other.root);
+						other.clear();
+					}
+					return *this;
 				}
 
-				template <typename Container>
-				requires requirements::containers::IsContainerOfT<Container, T>
-				bool find_word(Container const& word) const noexcept {
-					return !word.empty() && find_<Word>(word.begin(), word.end());
+				//deep copy, made without recursion, every children's level is allocated once with its final size
+				Trie clone () const {
+					Trie res;
+					copy_(root, res.root);
+					return res;
 				}
 
-				template <std::input_iterator Iter>
-				requires std::same_as<typename std::iter_value_t<Iter>, T>
-				bool find_word(Iter first, Iter last) const noexcept {
-					return first < last && find_<Word>(first, last);
+				void clear () noexcept {
+					root.next_level.clear();
+					root.is_leaf = false;
 				}
 
-				template <typename Container>
-				requires requirements::containers::IsContainerOfT<Container, T>
-				std::vector<T> find_prefix(Container const& prefix) const noexcept {
-					return prefix.empty() ? std::vector<T>{} : find_<Prefix>(prefix.begin(), prefix.end());
+				bool empty () const noexcept {
+					return !root.is_leaf && std::ranges::all_of(root.next_level, [](auto const& next){ return !next; });
 				}
 
-				template <std::input_iterator Iter>
+				template <typename Range>
+				requires requirements::containers::IsRangeOfT<Range, T>
+				void insert (Range&& r) {
+					insert(std::ranges::begin(r), std::ranges::end(r));
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
 				requires std::same_as<typename std::iter_value_t<Iter>, T>
-				std::vector<T> find_prefix(Iter first, Iter last) const noexcept {
-					return first < last ? find_<Prefix>(first, last) : std::vector<T>{};
+				void insert (Iter first, Sent last) {
+					if (first == last) return;
+					insert_(std::move(first), std::move(last));
 				}
 
-				template <typename Container>
-				requires requirements::containers::IsContainerOfT<Container, T>
-				bool is_prefix(Container const& prefix) const noexcept {
-					return !prefix.empty() && find_<Prefix>(prefix.begin(), prefix.end()).size() == prefix.size();
+				void insert (T const* c_str)
+				requires requirements::characters::IsCharacter<T> {
+					insert(c_str, null_terminated);
 				}
 
-				template <std::input_iterator Iter>
-				requires std::same_as<typename std::iter_value_t<Iter>, T>
-				bool is_prefix(Iter first, Iter last) const noexcept {
-					return first < last && find_<Prefix>(first, last).size() == std::distance(first, last);
+				/**
+				 * Set operations walk both tries side by side, so they cost time proportional to the structure
+				 * tries share plus whatever has to be copied, not a lookup per key.
+				 * With containers::trie::parallel every child of a root is processed by a task of its own.
+				 * */
+				template <typename Policy = sequential_t>
+				void merge (Trie const& other, Policy = {}) {
+					if (this == &other) return;
+					root.is_leaf = root.is_leaf || other.root.is_leaf;
+					auto& dst {root.next_level};
+					auto const& src {other.root.next_level};
+					if (dst.size() < src.size()) dst.resize(src.size());
+					for_each_index_<Policy>(src.size(), [&](std::size_t i){
+						if (src[i]) merge_(dst[i], *src[i]);
+					});
+				}
+
+				//subtrees this trie lacks are taken from other as they are, other is left empty
+				template <typename Policy = sequential_t>
+				void merge (Trie&& other, Policy = {}) {
+					if (this == &other) return;
+					root.is_leaf = root.is_leaf || other.root.is_leaf;
+					auto& dst {root.next_level};
+					auto& src {other.root.next_level};
+					if (dst.size() < src.size()) dst.resize(src.size());
+					for_each_index_<Policy>(src.size(), [&](std::size_t i){
+						if (src[i]) merge_(dst[i], std::move(src[i]));
+					});
+					other.clear();
+				}
+
+				template <typename Policy = sequential_t>
+				Trie intersection (Trie const& other, Policy = {}) const {
+					Trie res;
+					res.root.is_leaf = root.is_leaf && other.root.is_leaf;
+					auto const& lhs {root.next_level};
+					auto const& rhs {other.root.next_level};
+					auto& dst {res.root.next_level};
+					dst.resize(std::min(lhs.size(), rhs.size()));
+					for_each_index_<Policy>(dst.size(), [&](std::size_t i){
+						if (lhs[i] && rhs[i]) dst[i] = intersection_(*lhs[i], *rhs[i]);
+					});
+					return res;
+				}
+
+				template <typename Policy = sequential_t>
+				Trie difference (Trie const& other, Policy = {}) const {
+					Trie res;
+					res.root.is_leaf = root.is_leaf && !other.root.is_leaf;
+					auto const& lhs {root.next_level};
+					auto const& rhs {other.root.next_level};
+					auto& dst {res.root.next_level};
+					dst.resize(lhs.size());
+					for_each_index_<Policy>(dst.size(), [&](std::size_t i){
+						if (!lhs[i]) return;
+						dst[i] = i < rhs.size() && rhs[i] ? difference_(*lhs[i], *rhs[i]) : copy_(*lhs[i]);
+					});
+					return res;
+				}
+
+				//length of the longest prefix shared by some key of this trie and some key of other
+				std::size_t longest_common_prefix (Trie const& other) const {
+					return longest_common_prefix_(root, other.root);
+				}
+
+				//read-only handle of a node, to walk a trie from outside, e.g. to lay it out anew
+				class node_view final {
+				public:
+					node_view () = default;
+
+					explicit operator bool () const noexcept {
+						return node != nullptr;
+					}
+
+					bool is_leaf () const noexcept {
+						return node->is_leaf;
+					}
+
+					//indexes of children are below this bound, some of them may be absent
+					std::size_t fanout () const noexcept {
+						return node->next_level.size();
+					}
+
+					node_view child (std::size_t idx) const noexcept {
+						return idx < node->next_level.size() ? node_view{node->next_level[idx].get()} : node_view{};
+					}
+
+					//stays the same for a node as long as the trie isn't moved or destroyed
+					void const* id () const noexcept {
+						return node;
+					}
+
+					bool operator== (node_view const&) const = default;
+
+				private:
+					friend class Trie;
+					node_t const* node {nullptr};
+
+					explicit node_view (node_t const* n) noexcept : node (n) {}
+				};
+
+				node_view root_node () const noexcept {
+					return node_view{&root};
 				}
 
 			private:
-				std::unique_ptr<node_t> root;
-				GetIndex get_idx;
+				node_t root;
 
 			private:
 
-				std::optional<std::size_t> index(T const& t) const noexcept {
-					std::size_t idx {get_idx(t)};
-					return idx >= abc_size ? std::nullopt : std::optional<std::size_t>{idx};
+				node_t const* lookup_root_ () const noexcept {
+					return &root;
 				}
 
-				template <std::input_iterator Iter>
-				void insert_ (Iter first, Iter last) const {
-					node_t *node {root.get()};
-					for (auto it = first; it != last; ++it) {
-						auto const idx {index(*it)};
+				static node_t const* lookup_child_ (node_t const* node, std::size_t idx) noexcept {
+					return idx < node->next_level.size() ? node->next_level[idx].get() : nullptr;
+				}
+
+				static bool lookup_is_leaf_ (node_t const* node) noexcept {
+					return node->is_leaf;
+				}
+
+				template <std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+				void insert_ (Iter first, Sent last) {
+					node_t *node {&root};
+					for (auto it = std::move(first); it != last; ++it) {
+						auto const idx {index_of<abc_size>(this->get_idx, *it)};
 						if (!idx) break;
                         std::size_t const curr_idx {idx.value()};
 						if (node->next_level.size() <= curr_idx) {
@@ -168,42 +457,169 @@ namespace containers {
 				}
 
 
-				template <typename FindMode, std::input_iterator Iter>
-				auto find_(Iter first, Iter last) const noexcept {
-					bool is_found {true};
-					node_t *node {root.get()};
+				template <typename Policy, typename Func>
+				static void for_each_index_ (std::size_t count, Func func) {
+					if constexpr (std::is_same_v<Policy, parallel_t>) {
+						std::vector<std::future<void>> tasks;
+						tasks.reserve(count);
+						for (std::size_t i = 0; i != count; ++i) {
+							tasks.push_back(std::async(std::launch::async, func, i));
+						}
+						for (auto& task : tasks) task.get();
+					}
+					else if constexpr (std::is_same_v<Policy, sequential_t>) {
+						for (std::size_t i = 0; i != count; ++i) func(i);
+					}
+					else {
+						static_assert(always_false_v<Policy>, "Use either containers::trie::sequential or containers::trie::parallel");
+					}
+				}
 
-					[[maybe_unused]] std::vector<T> res;
-					res.reserve(1 << 7);
+				static void emplace_child_ (node_t& node, std::size_t idx, std::unique_ptr<node_t> child) {
+					if (!child) return;
+					if (node.next_level.size() <= idx) node.next_level.resize(idx + 1);
+					node.next_level[idx] = std::move(child);
+				}
 
-					for (auto it = first; it != last; ++it) {
-						auto const idx {index(*it)};
-						if (!idx || node->next_level.size() <= idx.value() || !node->next_level[idx.value()]) {
-							is_found = false;
-							break;
+				static void copy_ (node_t const& src, node_t& dst) {
+					std::vector<std::pair<node_t const*, node_t*>> pending {{&src, &dst}};
+					while (!pending.empty()) {
+						auto const [from, to] {pending.back()};
+						pending.pop_back();
+						to->is_leaf = from->is_leaf;
+						to->next_level.resize(from->next_level.size());
+						for (std::size_t i = 0; i != from->next_level.size(); ++i) {
+							if (!from->next_level[i]) continue;
+							to->next_level[i] = std::make_unique<node_t>();
+							pending.emplace_back(from->next_level[i].get(), to->next_level[i].get());
 						}
-						if constexpr (std::is_same_v<FindMode, Prefix>) {
-							res.push_back(*it);
+					}
+				}
+
+				static std::unique_ptr<node_t> copy_ (node_t const& src) {
+					auto res {std::make_unique<node_t>()};
+					copy_(src, *res);
+					return res;
+				}
+
+				static void merge_ (std::unique_ptr<node_t>& dst, node_t const& src) {
+					if (!dst) {
+						dst = copy_(src);
+						return;
+					}
+					std::vector<std::pair<node_t*, node_t const*>> pending {{dst.get(), &src}};
+					while (!pending.empty()) {
+						auto const [to, from] {pending.back()};
+						pending.pop_back();
+						to->is_leaf = to->is_leaf || from->is_leaf;
+						if (to->next_level.size() < from->next_level.size()) to->next_level.resize(from->next_level.size());
+						for (std::size_t i = 0; i != from->next_level.size(); ++i) {
+							if (!from->next_level[i]) continue;
+							if (!to->next_level[i]) to->next_level[i] = copy_(*from->next_level[i]);
+							else pending.emplace_back(to->next_level[i].get(), from->next_level[i].get());
 						}
-						node = node->next_level[idx.value()].get();
 					}
-					if constexpr (std::is_same_v<FindMode, Word>) {
-						return is_found && node->is_leaf;
+				}
+
+				static void merge_ (std::unique_ptr<node_t>& dst, std::unique_ptr<node_t>&& src) {
+					if (!dst) {
+						dst = std::move(src);
+						return;
 					}
-					else if constexpr (std::is_same_v<FindMode, Prefix>) {
-						return res;
+					std::vector<std::pair<node_t*, node_t*>> pending {{dst.get(), src.get()}};
+					while (!pending.empty()) {
+						auto const [to, from] {pending.back()};
+						pending.pop_back();
+						to->is_leaf = to->is_leaf || from->is_leaf;
+						if (to->next_level.size() < from->next_level.size()) to->next_level.resize(from->next_level.size());
+						for (std::size_t i = 0; i != from->next_level.size(); ++i) {
+							if (!from->next_level[i]) continue;
+							if (!to->next_level[i]) to->next_level[i] = std::move(from->next_level[i]);
+							else pending.emplace_back(to->next_level[i].get(), from->next_level[i].get());
+						}
 					}
-					else {
-						static_assert(false, "Class was modified erroneously, check the changes made");
-						return 42;
+				}
+
+				//a child created by a walk, as its parent and its index there
+				using created_t = std::vector<std::pair<node_t*, std::size_t>>;
+
+				//children are created before their subtrees, so going backwards drops empty ones bottom up
+				static std::unique_ptr<node_t> prune_ (std::unique_ptr<node_t> res, created_t const& created) {
+					auto const is_empty = [](node_t const& node){ return !node.is_leaf && node.next_level.empty(); };
+					for (auto it = created.rbegin(); it != created.rend(); ++it) {
+						auto& next_level {it->first->next_level};
+						if (!is_empty(*next_level[it->second])) continue;
+						next_level[it->second].reset();
+						while (!next_level.empty() && !next_level.back()) next_level.pop_back();
+					}
+					return is_empty(*res) ? nullptr : std::move(res);
+				}
+
+				//nullptr stands for an empty result, so no dead branches are left behind
+				static std::unique_ptr<node_t> intersection_ (node_t const& lhs, node_t const& rhs) {
+					auto res {std::make_unique<node_t>()};
+					created_t created;
+					std::vector<std::tuple<node_t const*, node_t const*, node_t*>> pending {{&lhs, &rhs, res.get()}};
+					while (!pending.empty()) {
+						auto const [l, r, to] {pending.back()};
+						pending.pop_back();
+						to->is_leaf = l->is_leaf && r->is_leaf;
+						std::size_t const count {std::min(l->next_level.size(), r->next_level.size())};
+						for (std::size_t i = 0; i != count; ++i) {
+							if (!l->next_level[i] || !r->next_level[i]) continue;
+							emplace_child_(*to, i, std::make_unique<node_t>());
+							created.emplace_back(to, i);
+							pending.emplace_back(l->next_level[i].get(), r->next_level[i].get(), to->next_level[i].get());
+						}
+					}
+					return prune_(std::move(res), created);
+				}
+
+				static std::unique_ptr<node_t> difference_ (node_t const& lhs, node_t const& rhs) {
+					auto res {std::make_unique<node_t>()};
+					created_t created;
+					std::vector<std::tuple<node_t const*, node_t const*, node_t*>> pending {{&lhs, &rhs, res.get()}};
+					while (!pending.empty()) {
+						auto const [l, r, to] {pending.back()};
+						pending.pop_back();
+						to->is_leaf = l->is_leaf && !r->is_leaf;
+						for (std::size_t i = 0; i != l->next_level.size(); ++i) {
+							if (!l->next_level[i]) continue;
+							bool const is_shared {i < r->next_level.size() && r->next_level[i]};
+							if (!is_shared) {
+								emplace_child_(*to, i, copy_(*l->next_level[i]));
+								continue;
+							}
+							emplace_child_(*to, i, std::make_unique<node_t>());
+							created.emplace_back(to, i);
+							pending.emplace_back(l->next_level[i].get(), r->next_level[i].get(), to->next_level[i].get());
+						}
+					}
+					return prune_(std::move(res), created);
+				}
+
+				static std::size_t longest_common_prefix_ (node_t const& lhs, node_t const& rhs) {
+					std::size_t res {0u};
+					std::vector<std::tuple<node_t const*, node_t const*, std::size_t>> pending {{&lhs, &rhs, 0u}};
+					while (!pending.empty()) {
+						auto const [l, r, depth] {pending.back()};
+						pending.pop_back();
+						res = std::max(res, depth);
+						std::size_t const count {std::min(l->next_level.size(), r->next_level.size())};
+						for (std::size_t i = 0; i != count; ++i) {
+							if (l->next_level[i] && r->next_level[i]) {
+								pending.emplace_back(l->next_level[i].get(), r->next_level[i].get(), depth + 1u);
+							}
+						}
 					}
+					return res;
 				}
 			};
 
 			struct GetIndex {
 				template <typename T>
 				std::size_t operator()(T) const noexcept {
-					static_assert(false, "One should use or add a specialization\n");
+					static_assert(always_false_v<T>, "One should use or add a specialization\n");
 					return 0lu;
 				}
 				template <typename T>
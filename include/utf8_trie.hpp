@@ -0,0 +1,383 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <string_view>
+
+namespace containers {
+
+	namespace trie {
+
+		namespace utf8 {
+
+			namespace details {
+
+				inline constexpr std::array<unsigned char, 128u> k_ascii_fold {[]{
+					std::array<unsigned char, 128u> res {};
+					for (std::size_t c = 0; c != res.size(); ++c) {
+						res[c] = static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c | 0x20u : c);
+					}
+					return res;
+				}()};
+
+				//stride 2 stands for ranges where upper and lower case letters alternate
+				struct fold_range final {
+					char32_t first, last;
+					std::int32_t delta;
+					std::uint8_t stride;
+				};
+
+				/**
+				 * Simple case folding, the C and S entries of CaseFolding.txt (Unicode 14) for the blocks
+				 * listed below, sorted by first and not overlapping, so a code point is found by binary search.
+				 * */
+				inline constexpr std::array<fold_range, 125u> k_fold_ranges {{
+						{0x00B5, 0x00B5, 0x307, 1},   // micro sign
+						{0x00C0, 0x00D6, 0x20, 1}, {0x00D8, 0x00DE, 0x20, 1},   // Latin-1
+						{0x0100, 0x012E, 1, 2}, {0x0132, 0x0136, 1, 2}, {0x0139, 0x0147, 1, 2}, {0x014A, 0x0176, 1, 2},   // Latin Extended-A
+						{0x0178, 0x0178, -0x79, 1}, {0x0179, 0x017D, 1, 2}, {0x017F, 0x017F, -0x10C, 1},
+						{0x0181, 0x0181, 0xD2, 1}, {0x0182, 0x0184, 1, 2}, {0x0186, 0x0186, 0xCE, 1}, {0x0187, 0x0187, 1, 1},   // Latin Extended-B
+						{0x0189, 0x018A, 0xCD, 1}, {0x018B, 0x018B, 1, 1}, {0x018E, 0x018E, 0x4F, 1},
+						{0x018F, 0x018F, 0xCA, 1}, {0x0190, 0x0190, 0xCB, 1}, {0x0191, 0x0191, 1, 1},
+						{0x0193, 0x0193, 0xCD, 1}, {0x0194, 0x0194, 0xCF, 1}, {0x0196, 0x0196, 0xD3, 1},
+						{0x0197, 0x0197, 0xD1, 1}, {0x0198, 0x0198, 1, 1}, {0x019C, 0x019C, 0xD3, 1},
+						{0x019D, 0x019D, 0xD5, 1}, {0x019F, 0x019F, 0xD6, 1}, {0x01A0, 0x01A4, 1, 2},
+						{0x01A6, 0x01A6, 0xDA, 1}, {0x01A7, 0x01A7, 1, 1}, {0x01A9, 0x01A9, 0xDA, 1}, {0x01AC, 0x01AC, 1, 1},
+						{0x01AE, 0x01AE, 0xDA, 1}, {0x01AF, 0x01AF, 1, 1}, {0x01B1, 0x01B2, 0xD9, 1}, {0x01B3, 0x01B5, 1, 2},
+						{0x01B7, 0x01B7, 0xDB, 1}, {0x01B8, 0x01B8, 1, 1}, {0x01BC, 0x01BC, 1, 1}, {0x01C4, 0x01C4, 2, 1},
+						{0x01C5, 0x01C5, 1, 1}, {0x01C7, 0x01C7, 2, 1}, {0x01C8, 0x01C8, 1, 1}, {0x01CA, 0x01CA, 2, 1},
+						{0x01CB, 0x01DB, 1, 2}, {0x01DE, 0x01EE, 1, 2}, {0x01F1, 0x01F1, 2, 1}, {0x01F2, 0x01F4, 1, 2},
+						{0x01F6, 0x01F6, -0x61, 1}, {0x01F7, 0x01F7, -0x38, 1}, {0x01F8, 0x021E, 1, 2},
+						{0x0220, 0x0220, -0x82, 1}, {0x0222, 0x0232, 1, 2}, {0x023A, 0x023A, 0x2A2B, 1},
+						{0x023B, 0x023B, 1, 1}, {0x023D, 0x023D, -0xA3, 1}, {0x023E, 0x023E, 0x2A28, 1},
+						{0x0241, 0x0241, 1, 1}, {0x0243, 0x0243, -0xC3, 1}, {0x0244, 0x0244, 0x45, 1},
+						{0x0245, 0x0245, 0x47, 1}, {0x0246, 0x024E, 1, 2},
+						{0x0345, 0x0345, 0x74, 1},   // Greek ypogegrammeni
+						{0x0370, 0x0372, 1, 2}, {0x0376, 0x0376, 1, 1}, {0x037F, 0x037F, 0x74, 1}, {0x0386, 0x0386, 0x26, 1},   // Greek
+						{0x0388, 0x038A, 0x25, 1}, {0x038C, 0x038C, 0x40, 1}, {0x038E, 0x038F, 0x3F, 1},
+						{0x0391, 0x03A1, 0x20, 1}, {0x03A3, 0x03AB, 0x20, 1}, {0x03C2, 0x03C2, 1, 1}, {0x03CF, 0x03CF, 8, 1},
+						{0x03D0, 0x03D0, -0x1E, 1}, {0x03D1, 0x03D1, -0x19, 1}, {0x03D5, 0x03D5, -0xF, 1},
+						{0x03D6, 0x03D6, -0x16, 1}, {0x03D8, 0x03EE, 1, 2}, {0x03F0, 0x03F0, -0x36, 1},
+						{0x03F1, 0x03F1, -0x30, 1}, {0x03F4, 0x03F4, -0x3C, 1}, {0x03F5, 0x03F5, -0x40, 1},
+						{0x03F7, 0x03F7, 1, 1}, {0x03F9, 0x03F9, -7, 1}, {0x03FA, 0x03FA, 1, 1}, {0x03FD, 0x03FF, -0x82, 1},
+						{0x0400, 0x040F, 0x50, 1}, {0x0410, 0x042F, 0x20, 1}, {0x0460, 0x0480, 1, 2}, {0x048A, 0x04BE, 1, 2},   // Cyrillic
+						{0x04C0, 0x04C0, 0xF, 1}, {0x04C1, 0x04CD, 1, 2}, {0x04D0, 0x04FE, 1, 2},
+						{0x0500, 0x052E, 1, 2},   // Cyrillic Supplement
+						{0x0531, 0x0556, 0x30, 1},   // Armenian
+						{0x1E00, 0x1E94, 1, 2}, {0x1E9B, 0x1E9B, -0x3A, 1}, {0x1E9E, 0x1E9E, -0x1DBF, 1},   // Latin Extended Additional
+						{0x1EA0, 0x1EFE, 1, 2},
+						{0x1F08, 0x1F0F, -8, 1}, {0x1F18, 0x1F1D, -8, 1}, {0x1F28, 0x1F2F, -8, 1}, {0x1F38, 0x1F3F, -8, 1},   // Greek Extended
+						{0x1F48, 0x1F4D, -8, 1}, {0x1F59, 0x1F5F, -8, 2}, {0x1F68, 0x1F6F, -8, 1}, {0x1F88, 0x1F8F, -8, 1},
+						{0x1F98, 0x1F9F, -8, 1}, {0x1FA8, 0x1FAF, -8, 1}, {0x1FB8, 0x1FB9, -8, 1},
+						{0x1FBA, 0x1FBB, -0x4A, 1}, {0x1FBC, 0x1FBC, -9, 1}, {0x1FBE, 0x1FBE, -0x1C05, 1},
+						{0x1FC8, 0x1FCB, -0x56, 1}, {0x1FCC, 0x1FCC, -9, 1}, {0x1FD8, 0x1FD9, -8, 1},
+						{0x1FDA, 0x1FDB, -0x64, 1}, {0x1FE8, 0x1FE9, -8, 1}, {0x1FEA, 0x1FEB, -0x70, 1},
+						{0x1FEC, 0x1FEC, -7, 1}, {0x1FF8, 0x1FF9, -0x80, 1}, {0x1FFA, 0x1FFB, -0x7E, 1},
+						{0x1FFC, 0x1FFC, -9, 1},
+				}};
+
+				static_assert([]{
+					for (std::size_t i = 1; i != k_fold_ranges.size(); ++i) {
+						if (k_fold_ranges[i - 1].last >= k_fold_ranges[i].first) return false;
+					}
+					return true;
+				}(), "fold ranges must be sorted and must not overlap");
+
+				inline constexpr std::uint64_t k_ones {0x0101010101010101ull};
+				inline constexpr std::uint64_t k_high_bits {0x8080808080808080ull};
+
+				inline bool is_ascii (std::uint64_t word) noexcept {
+					return (word & k_high_bits) == 0u;
+				}
+
+				//SWAR: every byte of an all-ASCII word in ['A', 'Z'] gets 0x20 set, no byte can carry into another
+				inline std::uint64_t fold_ascii (std::uint64_t word) noexcept {
+					std::uint64_t const ge_a {word + k_ones * (0x80u - 'A')};
+					std::uint64_t const gt_z {word + k_ones * (0x80u - 'Z' - 1u)};
+					return word | ((ge_a & ~gt_z & k_high_bits) >> 2u);
+				}
+
+				inline char32_t fold_code_point (char32_t cp) noexcept {
+					if (cp < 0x80u) return k_ascii_fold[cp];
+					auto const it {std::upper_bound(k_fold_ranges.begin(), k_fold_ranges.end(), cp,
+					                                [](char32_t c, fold_range const& range){ return c < range.first; })};
+					if (it == k_fold_ranges.begin()) return cp;
+					auto const& range {*std::prev(it)};
+					if (cp <= range.last && (cp - range.first) % range.stride == 0u) {
+						return static_cast<char32_t>(static_cast<std::int32_t>(cp) + range.delta);
+					}
+					return cp;
+				}
+
+				//length of a well-formed sequence starting at s[pos], 0 if it is not well-formed
+				inline std::size_t sequence_length (std::string_view s, std::size_t pos) noexcept {
+					auto const lead {static_cast<unsigned char>(s[pos])};
+					std::size_t const len {lead < 0x80u ? 1u : lead < 0xC2u ? 0u : lead < 0xE0u ? 2u : lead < 0xF0u ? 3u : lead < 0xF5u ? 4u : 0u};
+					if (len == 0u || pos + len > s.size()) return 0u;
+					//RFC 3629: overlong forms, surrogates and code points above U+10FFFF are cut by a second byte range
+					if (len == 1u) return 1u;
+					auto const second {static_cast<unsigned char>(s[pos + 1u])};
+					if ((lead == 0xE0u && second < 0xA0u) || (lead == 0xEDu && second > 0x9Fu) ||
+					    (lead == 0xF0u && second < 0x90u) || (lead == 0xF4u && second > 0x8Fu)) return 0u;
+					for (std::size_t i = 1; i != len; ++i) {
+						if ((static_cast<unsigned char>(s[pos + i]) & 0xC0u) != 0x80u) return 0u;
+					}
+					return len;
+				}
+
+				inline char32_t decode (char const* s, std::size_t len) noexcept {
+					auto const byte = [s](std::size_t i){ return static_cast<char32_t>(static_cast<unsigned char>(s[i])); };
+					switch (len) {
+						case 1u: return byte(0);
+						case 2u: return ((byte(0) & 0x1Fu) << 6) | (byte(1) & 0x3Fu);
+						case 3u: return ((byte(0) & 0x0Fu) << 12) | ((byte(1) & 0x3Fu) << 6) | (byte(2) & 0x3Fu);
+						default: return ((byte(0) & 0x07u) << 18) | ((byte(1) & 0x3Fu) << 12) | ((byte(2) & 0x3Fu) << 6) | (byte(3) & 0x3Fu);
+					}
+				}
+
+				inline std::size_t encode (char32_t cp, unsigned char* out) noexcept {
+					if (cp < 0x80u) {
+						out[0] = static_cast<unsigned char>(cp);
+						return 1u;
+					}
+					if (cp < 0x800u) {
+						out[0] = static_cast<unsigned char>(0xC0u | (cp >> 6));
+						out[1] = static_cast<unsigned char>(0x80u | (cp & 0x3Fu));
+						return 2u;
+					}
+					if (cp < 0x10000u) {
+						out[0] = static_cast<unsigned char>(0xE0u | (cp >> 12));
+						out[1] = static_cast<unsigned char>(0x80u | ((cp >> 6) & 0x3Fu));
+						out[2] = static_cast<unsigned char>(0x80u | (cp & 0x3Fu));
+						return 3u;
+					}
+					out[0] = static_cast<unsigned char>(0xF0u | (cp >> 18));
+					out[1] = static_cast<unsigned char>(0x80u | ((cp >> 12) & 0x3Fu));
+					out[2] = static_cast<unsigned char>(0x80u | ((cp >> 6) & 0x3Fu));
+					out[3] = static_cast<unsigned char>(0x80u | (cp & 0x3Fu));
+					return 4u;
+				}
+
+				/**
+				 * Calls func(bytes, count) for every code point of s, folded if asked to, and returns
+				 * how many bytes of s were consumed before func returned false.
+				 * Ill-formed bytes are passed one by one as they are.
+				 * */
+				template <bool fold_case, typename Func>
+				std::size_t for_each_code_point (std::string_view s, Func&& func) {
+					std::size_t pos {0u};
+					while (pos < s.size()) {
+						if constexpr (fold_case) {
+							if (std::uint64_t word; pos + sizeof(word) <= s.size()) {
+								std::memcpy(&word, s.data() + pos, sizeof(word));
+								if (is_ascii(word)) {
+									word = fold_ascii(word);
+									unsigned char bytes[sizeof(word)];
+									std::memcpy(bytes, &word, sizeof(word));
+									for (std::size_t i = 0; i != sizeof(word); ++i) {
+										if (!func(bytes + i, 1u)) return pos + i;
+									}
+									pos += sizeof(word);
+									continue;
+								}
+							}
+						}
+						unsigned char bytes[4u];
+						std::size_t const len {sequence_length(s, pos)};
+						std::size_t count {1u};
+						if (len == 0u) {
+							bytes[0] = static_cast<unsigned char>(s[pos]);
+						}
+						else if (len == 1u) {
+							auto const c {static_cast<unsigned char>(s[pos])};
+							bytes[0] = fold_case ? k_ascii_fold[c] : c;
+						}
+						else if constexpr (fold_case) {
+							count = encode(fold_code_point(decode(s.data() + pos, len)), bytes);
+						}
+						else {
+							std::memcpy(bytes, s.data() + pos, len);
+							count = len;
+						}
+						if (!func(static_cast<unsigned char const*>(bytes), count)) return pos;
+						pos += std::max(len, std::size_t{1u});
+					}
+					return pos;
+				}
+
+			}//!namespace details
+
+			/**
+			 * Simple case folding of Latin-1, Latin Extended-A, -B and Additional, Greek and Greek Extended,
+			 * Cyrillic and Cyrillic Supplement, Armenian letters and the micro sign, the rest is copied as is.
+			 * */
+			inline void fold_case (std::string_view in, std::string& out) {
+				out.reserve(out.size() + in.size());
+				details::for_each_code_point<true>(in, [&out](unsigned char const* bytes, std::size_t count){
+					out.append(reinterpret_cast<char const*>(bytes), count);
+					return true;
+				});
+			}
+
+			inline std::string fold_case (std::string_view in) {
+				std::string res;
+				fold_case(in, res);
+				return res;
+			}
+
+		}//!namespace utf8
+
+		namespace details {
+
+			/**
+			 * Trie of UTF-8 keys over a byte alphabet, so any key is stored in full.
+			 * Nodes are sparse: edges are kept sorted by a byte, scanned linearly while there are few of them
+			 * and binary searched otherwise, so a node costs memory in proportion to its real fanout.
+			 * Lookups move by whole code points: a prefix found never ends in a middle of a code point.
+			 * With fold_case keys and queries are case folded on the fly, eight ASCII bytes at a time.
+			 * */
+			template<bool fold_case = false>
+			class Utf8Trie final {
+			public:
+				using value_type = char;
+
+			private:
+				using index_t = std::uint32_t;
+
+				struct edge_t final {
+					unsigned char label;
+					index_t next;
+				};
+
+				//child_() gives 0 for a label with no edge
+				struct node_t final {
+					std::vector<edge_t> edges;
+					bool is_leaf {false};
+				};
+
+				static constexpr std::size_t k_linear_scan_max {8u};
+
+				struct walk_t final {
+					index_t node;
+					std::size_t consumed;
+					bool is_complete;
+				};
+
+			public:
+
+				Utf8Trie () : nodes (1u)
+				{}
+
+				void insert (std::string_view key) {
+					if (key.empty()) return;
+					index_t node {0u};
+					utf8::details::for_each_code_point<fold_case>(key, [&](unsigned char const* bytes, std::size_t count){
+						for (std::size_t i = 0; i != count; ++i) node = emplace_child_(node, bytes[i]);
+						return true;
+					});
+					nodes[node].is_leaf = true;
+				}
+
+				void insert (std::u8string_view key) {
+					insert(as_chars_(key));
+				}
+
+				bool find_word (std::string_view word) const noexcept {
+					if (word.empty()) return false;
+					auto const walk {walk_(word)};
+					return walk.is_complete && nodes[walk.node].is_leaf;
+				}
+
+				bool find_word (std::u8string_view word) const noexcept {
+					return find_word(as_chars_(word));
+				}
+
+				bool is_prefix (std::string_view prefix) const noexcept {
+					return !prefix.empty() && walk_(prefix).is_complete;
+				}
+
+				bool is_prefix (std::u8string_view prefix) const noexcept {
+					return is_prefix(as_chars_(prefix));
+				}
+
+				//the longest head of a prefix, as it is in the input, that leads somewhere in the trie
+				std::string_view find_prefix (std::string_view prefix) const noexcept {
+					return prefix.substr(0u, walk_(prefix).consumed);
+				}
+
+				std::size_t nodes_count () const noexcept {
+					return nodes.size();
+				}
+
+			private:
+				std::vector<node_t> nodes;
+
+			private:
+
+				static std::string_view as_chars_ (std::u8string_view s) noexcept {
+					return {reinterpret_cast<char const*>(s.data()), s.size()};
+				}
+
+				index_t child_ (index_t node, unsigned char label) const noexcept {
+					auto const& edges {nodes[node].edges};
+					if (edges.size() <= k_linear_scan_max) {
+						for (auto const& edge : edges) {
+							if (edge.label == label) return edge.next;
+						}
+						return 0u;
+					}
+					auto const it {std::lower_bound(edges.begin(), edges.end(), label, [](edge_t const& edge, unsigned char l){
+						return edge.label < l;
+					})};
+					return it != edges.end() && it->label == label ? it->next : 0u;
+				}
+
+				index_t emplace_child_ (index_t node, unsigned char label) {
+					if (index_t const next {child_(node, label)}; next != 0u) return next;
+					index_t const next {static_cast<index_t>(nodes.size())};
+					nodes.emplace_back();
+					auto& edges {nodes[node].edges};
+					auto const it {std::lower_bound(edges.begin(), edges.end(), label, [](edge_t const& edge, unsigned char l){
+						return edge.label < l;
+					})};
+					edges.insert(it, edge_t{label, next});
+					return next;
+				}
+
+				walk_t walk_ (std::string_view key) const noexcept {
+					index_t node {0u};
+					bool is_complete {true};
+					std::size_t const consumed {utf8::details::for_each_code_point<fold_case>(key, [&](unsigned char const* bytes, std::size_t count){
+						index_t curr {node};
+						for (std::size_t i = 0; i != count; ++i) {
+							curr = child_(curr, bytes[i]);
+							if (curr == 0u) {
+								is_complete = false;
+								return false;
+							}
+						}
+						node = curr;
+						return true;
+					})};
+					return {node, consumed, is_complete};
+				}
+			};
+
+		}//!namespace details
+
+		using of_utf8 = details::Utf8Trie<false>;
+
+		using of_utf8_nocase = details::Utf8Trie<true>;
+
+	}//!namespace trie
+
+}//!namespace containers
@@ -0,0 +1,50 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "../include/trie.hpp"
+
+#include <string>
+#include <vector>
+#include <random>
+
+namespace tests {
+
+	//words of the first letters of an alphabet, few letters make many shared prefixes
+	inline std::vector<std::string> make_words (std::size_t count, std::mt19937& gen, int letters, int max_length) {
+		std::uniform_int_distribution<int> letter (0, letters - 1), length (1, max_length);
+		std::vector<std::string> res (count);
+		for (auto& word : res) {
+			word.resize(static_cast<std::size_t>(length(gen)));
+			for (auto& c : word) c = static_cast<char>('a' + letter(gen));
+		}
+		return res;
+	}
+
+	//keys sharing prefixes, in both cases, and queries around them
+	inline std::vector<std::string> const k_words {"apple", "app", "Banana", "b", "band", "zed"};
+	inline std::vector<std::string> const k_queries {"apple", "APP", "ap", "a", "banana", "ban", "b", "bandana", "zed", "zedd", "zzz", ""};
+
+	inline ::containers::trie::of_char make_trie (std::vector<std::string> const& words) {
+		::containers::trie::of_char trie;
+		for (auto const& word : words) trie.insert(word);
+		return trie;
+	}
+
+	//any lookup other has must answer as of_char does
+	template <typename Other>
+	void compare (::containers::trie::of_char const& trie, Other const& other, std::vector<std::string> const& queries) {
+		for (auto const& query : queries) {
+			ASSERT_EQ(other.find_word(query), trie.find_word(query)) << query;
+			ASSERT_EQ(other.is_prefix(query), trie.is_prefix(query)) << query;
+			if constexpr (requires { other.find_prefix(query); }) {
+				ASSERT_EQ(other.find_prefix(query), trie.find_prefix(query)) << query;
+			}
+		}
+	}
+
+}//!namespace tests
@@ -0,0 +1,100 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/bit_trie.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
+
+/**
+ * max xor is checked against LeetCode 421 Maximum XOR of Two Numbers in an Array
+ * https://leetcode.com/problems/maximum-xor-of-two-numbers-in-an-array/description/
+ * */
+
+TEST(bits, t1_max_xor) {
+	std::vector<int> nums {3, 10, 5, 25, 2, 8};
+	::containers::trie::of_bits<int, 31u> trie (nums);
+
+	unsigned res {0u};
+	for (int n : nums) res = std::max(res, trie.max_xor(n).value());
+	ASSERT_EQ(res, 28u);
+}
+
+TEST(bits, t2_empty) {
+	::containers::trie::of_bits<std::uint32_t> trie;
+	ASSERT_TRUE(trie.empty());
+	ASSERT_FALSE(trie.max_xor(42u).has_value());
+	ASSERT_FALSE(trie.min_xor(42u).has_value());
+	ASSERT_EQ(trie.count_xor_less(42u, 100u), 0u);
+
+	std::vector<std::uint32_t> in {1u, 2u, 3u}, out;
+	trie.max_xor(in.begin(), in.end(), std::back_inserter(out));
+	ASSERT_TRUE(out.empty());
+}
+
+TEST(bits, t3_erase) {
+	::containers::trie::of_bits<std::uint8_t> trie;
+	trie.insert(std::uint8_t{7});
+	trie.insert(std::uint8_t{7});
+	trie.insert(std::uint8_t{200});
+	ASSERT_EQ(trie.size(), 3u);
+	ASSERT_EQ(trie.count(7), 2u);
+
+	ASSERT_TRUE(trie.erase(200));
+	ASSERT_FALSE(trie.erase(200));
+	ASSERT_FALSE(trie.contains(200));
+	ASSERT_EQ(trie.max_xor(200).value(), std::uint8_t(200 ^ 7));
+
+	ASSERT_TRUE(trie.erase(7));
+	ASSERT_TRUE(trie.erase(7));
+	ASSERT_TRUE(trie.empty());
+	ASSERT_FALSE(trie.max_xor(0).has_value());
+}
+
+TEST(bits, t4_random_vs_brute_force) {
+	std::mt19937 gen (42);
+	std::uniform_int_distribution<std::uint32_t> dist (0u, (1u << 12) - 1u);
+
+	std::vector<std::uint32_t> stored (500), queries (300);
+	std::generate(stored.begin(), stored.end(), [&]{ return dist(gen); });
+	std::generate(queries.begin(), queries.end(), [&]{ return dist(gen); });
+
+	::containers::trie::of_bits<std::uint32_t, 12u> trie (stored);
+	ASSERT_EQ(trie.size(), stored.size());
+
+	std::vector<std::uint32_t> batch_max, batch_min;
+	trie.max_xor(queries.begin(), queries.end(), std::back_inserter(batch_max));
+	trie.min_xor(queries.begin(), queries.end(), std::back_inserter(batch_min));
+	ASSERT_EQ(batch_max.size(), queries.size());
+	ASSERT_EQ(batch_min.size(), queries.size());
+
+	std::uint32_t const k {dist(gen)};
+	std::vector<std::size_t> batch_less;
+	trie.count_xor_less(queries.begin(), queries.end(), k, std::back_inserter(batch_less));
+
+	for (std::size_t i = 0; i != queries.size(); ++i) {
+		std::uint32_t const x {queries[i]};
+		std::uint32_t max_xor {0u}, min_xor {~0u};
+		std::size_t less {0u};
+		for (std::uint32_t y : stored) {
+			max_xor = std::max(max_xor, x ^ y);
+			min_xor = std::min(min_xor, x ^ y);
+			if ((x ^ y) < k) ++less;
+		}
+		ASSERT_EQ(trie.max_xor(x).value(), max_xor) << i;
+		ASSERT_EQ(trie.min_xor(x).value(), min_xor) << i;
+		ASSERT_EQ(trie.count_xor_less(x, k), less) << i;
+		ASSERT_EQ(batch_max[i], max_xor) << i;
+		ASSERT_EQ(batch_min[i], min_xor) << i;
+		ASSERT_EQ(batch_less[i], less) << i;
+	}
+
+	//k beyond the trie width counts everything
+	ASSERT_EQ(trie.count_xor_less(0u, 1u << 12), stored.size());
+}
@@ -0,0 +1,49 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/frozen_trie.hpp"
+#include "helpers.hpp"
+
+#include <string>
+#include <vector>
+#include <random>
+
+TEST(frozen, t1_same_answers_as_trie) {
+	auto const trie {tests::make_trie(tests::k_words)};
+	::containers::trie::frozen_of_char const frozen (trie);
+	tests::compare(trie, frozen, tests::k_queries);
+
+	ASSERT_EQ(frozen.nodes_count(), 1u + 5u + 6u + 1u + 3u);
+	ASSERT_TRUE(frozen.find_word("APPLE"));
+	ASSERT_EQ(frozen.find_prefix("bandana"), (std::vector<char>{'b', 'a', 'n', 'd'}));
+
+	::containers::trie::of_char const empty;
+	::containers::trie::frozen_of_char const frozen_empty (empty);
+	ASSERT_EQ(frozen_empty.nodes_count(), 1u);
+	ASSERT_FALSE(frozen_empty.find_word("a"));
+}
+
+TEST(frozen, t2_every_layout) {
+	std::mt19937 gen (42);
+	auto const words {tests::make_words(3000u, gen, 6, 9)};
+	auto const queries {tests::make_words(3000u, gen, 6, 9)};
+	auto const trie {tests::make_trie(words)};
+
+	using ::containers::trie::node_order;
+	std::vector<std::string> const samples (words.begin(), words.begin() + 100);
+	for (node_order order : {node_order::breadth_first, node_order::blocked}) {
+		for (std::size_t top_nodes : {std::size_t{0u}, std::size_t{1u}, std::size_t{64u}, std::size_t{1u << 12}}) {
+			::containers::trie::relayout_options const options {order, top_nodes, top_nodes == 64u};
+			::containers::trie::frozen_of_char const frozen (trie, options);
+			tests::compare(trie, frozen, words);
+			tests::compare(trie, frozen, queries);
+			::containers::trie::frozen_of_char const guided (trie, samples, options);
+			ASSERT_EQ(guided.nodes_count(), frozen.nodes_count());
+			tests::compare(trie, guided, words);
+			tests::compare(trie, guided, queries);
+		}
+	}
+}
@@ -46,6 +46,21 @@ auto get_res = [](std::vector<int> const& arr1, std::vector<int> const& arr2){
 	return res;
 };
 
+auto get_res_of_tries = [](std::vector<int> const& arr1, std::vector<int> const& arr2){
+	std::array<int, 10> digits;
+	int digits_count;
+	::containers::trie::of_int trie1, trie2;
+	for (int i : arr1) {
+		get_digits(i, digits, digits_count);
+		trie1.insert(digits.begin(), digits.begin() + digits_count);
+	}
+	for (int i : arr2) {
+		get_digits(i, digits, digits_count);
+		trie2.insert(digits.begin(), digits.begin() + digits_count);
+	}
+	return trie1.longest_common_prefix(trie2);
+};
+
 TEST(integers, t1){
 	std::vector<int> arr1{1, 2, 3};
 	std::vector<int> arr2{4, 4, 4};
@@ -58,3 +73,14 @@ TEST(integers, t2){
 	std::vector<int> arr2{17, 11};
 	ASSERT_EQ(get_res(arr1, arr2), 1);
 }
+
+TEST(integers, t3){
+	std::vector<int> arr1{1, 10, 100};
+	std::vector<int> arr2{1000};
+	ASSERT_EQ(get_res(arr1, arr2), 3);
+	ASSERT_EQ(get_res_of_tries(arr1, arr2), 3);
+	ASSERT_EQ(get_res_of_tries(arr2, arr1), 3);
+	//the cases of t1 and t2, walking both tries side by side
+	ASSERT_EQ(get_res_of_tries({1, 2, 3}, {4, 4, 4}), 0);
+	ASSERT_EQ(get_res_of_tries({10}, {17, 11}), 1);
+}
@@ -0,0 +1,191 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/paged_trie.hpp"
+#include "../include/frozen_trie.hpp"
+#include "helpers.hpp"
+
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <fstream>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <algorithm>
+#include <utility>
+#include <string>
+#include <vector>
+
+namespace {
+
+	//a paged trie seen through sync_wait(), so it is checked as any other trie
+	struct sync_lookup final {
+		::containers::trie::paged_of_char const& paged;
+
+		bool find_word (std::string const& word) const {
+			return ::containers::trie::sync_wait(paged.find_word_async(word));
+		}
+		bool is_prefix (std::string const& prefix) const {
+			return ::containers::trie::sync_wait(paged.is_prefix_async(prefix));
+		}
+	};
+
+	//a file per test, removed when a test is over
+	struct temp_file final {
+		std::filesystem::path path;
+		explicit temp_file (char const* name) : path (std::filesystem::temp_directory_path() / name)
+		{}
+		~temp_file () {
+			std::error_code ec;
+			std::filesystem::remove(path, ec);
+		}
+	};
+
+	::containers::trie::task<int> count_found (::containers::trie::paged_of_char const& paged, std::vector<std::string> words) {
+		int res {0};
+		for (auto const& word : words) res += co_await paged.find_word_async(word);
+		co_return res;
+	}
+
+	//blocks on a second lookup after awaiting a first one
+	::containers::trie::task<bool> await_then_block (::containers::trie::paged_of_char const& paged, std::string first, std::string second) {
+		bool const found {co_await paged.find_word_async(first)};
+		co_return found && ::containers::trie::sync_wait(paged.find_word_async(second));
+	}
+
+	::containers::trie::task<bool> sync_wait_refused (::containers::trie::paged_of_char const& paged, std::string word) {
+		co_await paged.find_word_async(word);
+		try {
+			::containers::trie::sync_wait(paged.find_word_async(word));
+		}
+		catch (std::logic_error const&) {
+			co_return true;
+		}
+		co_return false;
+	}
+
+}//!namespace
+
+TEST(paged, t1_same_answers_as_trie) {
+	using ::containers::trie::sync_wait;
+	temp_file const file ("trie_tests_paged_t1.bin");
+	auto const trie {tests::make_trie(tests::k_words)};
+	::containers::trie::paged_of_char::write(trie, file.path);
+
+	::containers::trie::paged_of_char const paged (file.path, {.cache_pages = 1u, .io_threads = 1u});
+	ASSERT_EQ(paged.nodes_count(), 1u + 5u + 6u + 1u + 3u);
+	//the only page is pinned on opening, lookups read nothing
+	ASSERT_EQ(paged.pages_read(), 1u);
+	tests::compare(trie, sync_lookup{paged}, tests::k_queries);
+	ASSERT_TRUE(sync_wait(paged.find_word_async("APPLE")));
+	std::string const word {"zed!"};
+	ASSERT_TRUE(sync_wait(paged.find_word_async(word.begin(), word.end() - 1)));
+	ASSERT_EQ(sync_wait(count_found(paged, {"app", "apple", "apples", "zed"})), 3);
+	ASSERT_EQ(paged.pages_read(), 1u);
+}
+
+TEST(paged, t2_concurrent_lookups_and_cache) {
+	using ::containers::trie::sync_wait;
+	temp_file const file ("trie_tests_paged_t2.bin");
+	std::mt19937 gen (42);
+	auto const words {tests::make_words(5000u, gen, 6, 12)};
+	auto queries {tests::make_words(5000u, gen, 6, 12)};
+	queries.insert(queries.end(), words.begin(), words.end());
+	auto const trie {tests::make_trie(words)};
+	::containers::trie::paged_of_char::write(trie, file.path);
+
+	//a cache much smaller than a trie, so pages are dropped and read again, with and without pinned top pages
+	for (std::size_t pinned_pages : {std::size_t{0u}, std::size_t{3u}}) {
+		::containers::trie::paged_of_char const paged (file.path, {.cache_pages = 4u, .io_threads = 4u, .pinned_pages = pinned_pages});
+		ASSERT_EQ(paged.pages_read(), pinned_pages);
+		std::vector<::containers::trie::task<bool>> words_found, prefixes_found;
+		for (auto const& query : queries) {
+			words_found.push_back(paged.find_word_async(query));
+			prefixes_found.push_back(paged.is_prefix_async(query));
+		}
+		auto const is_word {sync_wait(std::move(words_found))};
+		auto const is_prefix {sync_wait(std::move(prefixes_found))};
+		for (std::size_t i = 0; i != queries.size(); ++i) {
+			ASSERT_EQ(is_word[i], trie.find_word(queries[i])) << queries[i];
+			ASSERT_EQ(is_prefix[i], trie.is_prefix(queries[i])) << queries[i];
+		}
+	}
+
+	::containers::trie::paged_of_char const paged (file.path, {.cache_pages = 4u, .io_threads = 4u, .pinned_pages = 0u});
+	//pages of a hot path stay cached
+	ASSERT_TRUE(sync_wait(paged.find_word_async(words[0])));
+	std::size_t const reads {paged.pages_read()};
+	for (int i = 0; i != 10; ++i) ASSERT_TRUE(sync_wait(paged.find_word_async(words[0])));
+	ASSERT_EQ(paged.pages_read(), reads);
+}
+
+TEST(paged, t3_bad_files) {
+	temp_file const file ("trie_tests_paged_t3.bin");
+	ASSERT_THROW(::containers::trie::paged_of_char(file.path), std::system_error);
+	{
+		std::ofstream out (file.path, std::ios::binary);
+		out << std::string(8192u, 'x');
+	}
+	ASSERT_THROW(::containers::trie::paged_of_char(file.path), std::runtime_error);
+}
+
+TEST(paged, t4_write_sorted) {
+	using ::containers::trie::sync_wait;
+	temp_file const file ("trie_tests_paged_t4.bin");
+	std::mt19937 gen (7);
+	auto words {tests::make_words(3000u, gen, 6, 12)};
+	auto const queries {tests::make_words(3000u, gen, 6, 12)};
+	words.push_back("abc1");
+	words.push_back("ab");
+	std::ranges::sort(words);
+	auto const trie {tests::make_trie(words)};
+
+	//keys come from a stream one by one, duplicates included
+	std::stringstream stream;
+	for (auto const& word : words) stream << word << ' ';
+	::containers::trie::paged_of_char::write_sorted(std::views::istream<std::string>(stream), file.path);
+
+	::containers::trie::paged_of_char const paged (file.path, {.cache_pages = 2u, .io_threads = 2u});
+	ASSERT_EQ(paged.nodes_count(), ::containers::trie::frozen_of_char(trie).nodes_count());
+	tests::compare(trie, sync_lookup{paged}, words);
+	tests::compare(trie, sync_lookup{paged}, queries);
+
+	std::vector<std::string> const empty;
+	::containers::trie::paged_of_char::write_sorted(empty, file.path);
+	ASSERT_FALSE(sync_wait(::containers::trie::paged_of_char(file.path).find_word_async("a")));
+
+	std::vector<std::string> const unsorted {"abc", "abd", "ab"};
+	ASSERT_THROW(::containers::trie::paged_of_char::write_sorted(unsorted, file.path), std::invalid_argument);
+	std::vector<std::string> const descending {"b", "a"};
+	ASSERT_THROW(::containers::trie::paged_of_char::write_sorted(descending, file.path), std::invalid_argument);
+}
+
+TEST(paged, t5_blocking_after_a_miss) {
+	using ::containers::trie::sync_wait;
+	temp_file const file ("trie_tests_paged_t5.bin");
+	std::mt19937 gen (5);
+	auto const words {tests::make_words(3000u, gen, 6, 12)};
+	auto const trie {tests::make_trie(words)};
+	::containers::trie::paged_of_char::write(trie, file.path);
+
+	//a single I/O thread and nothing cached, so both lookups miss and need that thread
+	::containers::trie::paged_of_char const paged (file.path, {.cache_pages = 1u, .io_threads = 1u, .pinned_pages = 0u});
+	ASSERT_TRUE(sync_wait(await_then_block(paged, words.front(), words.back())));
+	std::vector<::containers::trie::task<bool>> tasks;
+	for (std::size_t i = 0; i + 1 < 100u; ++i) tasks.push_back(await_then_block(paged, words[i], words[i + 1]));
+	for (bool found : sync_wait(std::move(tasks))) ASSERT_TRUE(found);
+
+	//a coroutine not started by sync_wait() goes on on an I/O thread, where sync_wait() is refused
+	::containers::trie::paged_of_char const cold (file.path, {.cache_pages = 1u, .io_threads = 1u, .pinned_pages = 0u});
+	auto const queue {std::make_shared<::containers::trie::details::RunQueue>()};
+	std::promise<bool> refused;
+	auto future {refused.get_future()};
+	queue->add_pending(1u);
+	::containers::trie::details::run_detached(sync_wait_refused(cold, words.front()), std::move(refused), queue);
+	ASSERT_TRUE(future.get());
+}
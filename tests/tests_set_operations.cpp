@@ -0,0 +1,122 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/trie.hpp"
+#include "helpers.hpp"
+
+#include <string>
+#include <vector>
+#include <set>
+#include <random>
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+	::containers::trie::of_char make_trie (std::set<std::string> const& words) {
+		::containers::trie::of_char trie;
+		for (auto const& word : words) trie.insert(word);
+		return trie;
+	}
+
+	//every word of a universe is looked up, and every prefix of a result must lead to a result's word
+	void check (::containers::trie::of_char const& trie,
+	            std::set<std::string> const& expected,
+	            std::set<std::string> const& universe) {
+		for (auto const& word : universe) {
+			ASSERT_EQ(trie.find_word(word), expected.contains(word)) << word;
+			bool const is_prefix_expected {std::any_of(expected.begin(), expected.end(), [&](auto const& e){
+				return e.starts_with(word);
+			})};
+			ASSERT_EQ(trie.is_prefix(word), is_prefix_expected) << word;
+		}
+	}
+
+}//!namespace
+
+TEST(set_operations, t1_random) {
+	std::mt19937 gen (42);
+	for (int round = 0; round != 20; ++round) {
+		auto const words_1 {tests::make_words(60u, gen, 4, 6)}, words_2 {tests::make_words(60u, gen, 4, 6)};
+		std::set<std::string> const lhs (words_1.begin(), words_1.end()), rhs (words_2.begin(), words_2.end());
+
+		std::set<std::string> universe {lhs};
+		universe.insert(rhs.begin(), rhs.end());
+		for (auto const& word : tests::make_words(100u, gen, 4, 6)) universe.insert(word);
+
+		std::set<std::string> expected_union, expected_intersection, expected_difference;
+		std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::inserter(expected_union, expected_union.end()));
+		std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::inserter(expected_intersection, expected_intersection.end()));
+		std::set_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::inserter(expected_difference, expected_difference.end()));
+
+		auto const trie_lhs {make_trie(lhs)}, trie_rhs {make_trie(rhs)};
+
+		check(trie_lhs.intersection(trie_rhs), expected_intersection, universe);
+		check(trie_lhs.intersection(trie_rhs, ::containers::trie::parallel), expected_intersection, universe);
+		check(trie_lhs.difference(trie_rhs), expected_difference, universe);
+		check(trie_lhs.difference(trie_rhs, ::containers::trie::parallel), expected_difference, universe);
+
+		auto merged_copy {make_trie(lhs)};
+		merged_copy.merge(trie_rhs);
+		check(merged_copy, expected_union, universe);
+		check(trie_rhs, rhs, universe);
+
+		auto merged_move {make_trie(lhs)};
+		merged_move.merge(make_trie(rhs), ::containers::trie::parallel);
+		check(merged_move, expected_union, universe);
+
+		auto moved_from {make_trie(rhs)};
+		auto merged_parallel {make_trie(lhs)};
+		merged_parallel.merge(std::move(moved_from), ::containers::trie::parallel);
+		check(merged_parallel, expected_union, universe);
+		check(moved_from, {}, universe);
+	}
+}
+
+TEST(set_operations, t2_longest_common_prefix) {
+	::containers::trie::of_char lhs, rhs, empty;
+	lhs.insert(std::string("flower"));
+	lhs.insert(std::string("flow"));
+	rhs.insert(std::string("flight"));
+	rhs.insert(std::string("dog"));
+
+	ASSERT_EQ(lhs.longest_common_prefix(rhs), 2u);
+	ASSERT_EQ(rhs.longest_common_prefix(lhs), 2u);
+	ASSERT_EQ(lhs.longest_common_prefix(lhs), 6u);
+	ASSERT_EQ(lhs.longest_common_prefix(empty), 0u);
+
+	rhs.insert(std::string("flowers"));
+	ASSERT_EQ(lhs.longest_common_prefix(rhs), 6u);
+}
+
+TEST(set_operations, t3_long_keys) {
+	//bit strings far longer than a stack could recurse over, ending differently
+	std::size_t const length {200000u};
+	std::vector<bool> key_1 (length, true), key_2 (length, true), key_3 (length / 2u, true);
+	key_2.back() = false;
+	::containers::trie::of_bool lhs, rhs;
+	lhs.insert(key_1);
+	lhs.insert(key_3);
+	rhs.insert(key_2);
+	rhs.insert(key_3);
+
+	ASSERT_EQ(lhs.longest_common_prefix(rhs), length - 1u);
+	auto const common {lhs.intersection(rhs, ::containers::trie::parallel)};
+	ASSERT_TRUE(common.find_word(key_3));
+	ASSERT_FALSE(common.find_word(key_1));
+	ASSERT_FALSE(common.is_prefix(key_1));
+	auto const only_lhs {lhs.difference(rhs)};
+	ASSERT_TRUE(only_lhs.find_word(key_1));
+	ASSERT_FALSE(only_lhs.find_word(key_3));
+
+	auto merged {lhs.clone()};
+	merged.merge(rhs, ::containers::trie::parallel);
+	ASSERT_TRUE(merged.find_word(key_1));
+	ASSERT_TRUE(merged.find_word(key_2));
+	merged.merge(rhs.clone());
+	ASSERT_TRUE(merged.find_word(key_2));
+	ASSERT_TRUE(merged.find_word(key_3));
+}
@@ -0,0 +1,54 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/sharded_trie.hpp"
+#include "helpers.hpp"
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <random>
+
+TEST(sharded, t1_same_answers_as_trie) {
+	auto words {tests::k_words};
+	words.push_back("x1y");
+	auto const trie {tests::make_trie(words)};
+	::containers::trie::sharded_of_char<16u, 2u> sharded;
+	for (auto const& word : words) sharded.insert(word);
+	auto queries {tests::k_queries};
+	queries.insert(queries.end(), {"x", "x1", "x1y"});
+	tests::compare(trie, sharded, queries);
+	//"x1y" is cut at '1' by a trie, so it is both stored and looked up as "x"
+	ASSERT_TRUE(sharded.find_word(std::string("x")));
+}
+
+TEST(sharded, t2_concurrent_readers_and_writers) {
+	std::mt19937 gen (42);
+	auto const words {tests::make_words(5000u, gen, 26, 6)};
+	::containers::trie::sharded_of_char<> sharded;
+	for (std::size_t i = 0; i != 1000u; ++i) sharded.insert(words[i]);
+
+	std::atomic<bool> is_ok {true};
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t != 4u; ++t) {
+		threads.emplace_back([&, t]{
+			for (std::size_t i = 1000u + t; i < words.size(); i += 4u) sharded.insert(words[i]);
+		});
+		threads.emplace_back([&]{
+			for (int round = 0; round != 5; ++round) {
+				for (std::size_t i = 0; i != 1000u; ++i) {
+					auto const& word {words[i]};
+					if (!sharded.find_word(word) || !sharded.is_prefix(word.substr(0, 1))) is_ok = false;
+				}
+			}
+		});
+	}
+	for (auto& thread : threads) thread.join();
+
+	ASSERT_TRUE(is_ok);
+	for (auto const& word : words) ASSERT_TRUE(sharded.find_word(word)) << word;
+}
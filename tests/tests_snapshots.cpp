@@ -0,0 +1,123 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/trie.hpp"
+#include "../include/persistent_trie.hpp"
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <optional>
+
+TEST(snapshots, t1_move) {
+	::containers::trie::of_char trie;
+	trie.insert("hello");
+
+	::containers::trie::of_char moved {std::move(trie)};
+	ASSERT_TRUE(moved.find_word("hello"));
+	ASSERT_TRUE(trie.empty());
+	ASSERT_FALSE(trie.find_word("hello"));
+	ASSERT_FALSE(trie.is_prefix("h"));
+
+	trie.insert("world");
+	ASSERT_TRUE(trie.find_word("world"));
+
+	moved = std::move(trie);
+	ASSERT_TRUE(moved.find_word("world"));
+	ASSERT_FALSE(moved.find_word("hello"));
+	ASSERT_TRUE(trie.empty());
+}
+
+TEST(snapshots, t2_clone) {
+	::containers::trie::of_char trie;
+	for (auto const* word : {"apple", "app", "banana", "band"}) trie.insert(word);
+
+	auto copy {trie.clone()};
+	trie.insert("bandana");
+	copy.insert("applet");
+
+	for (auto const* word : {"apple", "app", "banana", "band"}) {
+		ASSERT_TRUE(trie.find_word(word)) << word;
+		ASSERT_TRUE(copy.find_word(word)) << word;
+	}
+	ASSERT_TRUE(trie.find_word("bandana"));
+	ASSERT_FALSE(copy.find_word("bandana"));
+	ASSERT_TRUE(copy.find_word("applet"));
+	ASSERT_FALSE(trie.find_word("applet"));
+	ASSERT_FALSE(copy.find_word("ban"));
+	ASSERT_TRUE(copy.is_prefix("ban"));
+
+	ASSERT_TRUE(::containers::trie::of_char{}.clone().empty());
+}
+
+TEST(snapshots, t3_persistent) {
+	::containers::trie::persistent_of_char builder;
+	builder.insert("apple");
+	builder.insert("band");
+
+	auto const snapshot {builder.snapshot()};
+	ASSERT_TRUE(snapshot.shares_root_with(builder));
+
+	builder.insert("apple");
+	ASSERT_TRUE(snapshot.shares_root_with(builder));
+
+	builder.insert("applet");
+	builder.insert("banana");
+	ASSERT_FALSE(snapshot.shares_root_with(builder));
+
+	ASSERT_TRUE(builder.find_word("applet"));
+	ASSERT_TRUE(builder.find_word("banana"));
+	ASSERT_TRUE(builder.find_word("apple"));
+	ASSERT_FALSE(snapshot.find_word("applet"));
+	ASSERT_FALSE(snapshot.find_word("banana"));
+	ASSERT_FALSE(snapshot.is_prefix("bana"));
+	ASSERT_TRUE(snapshot.find_word("apple"));
+	ASSERT_TRUE(snapshot.find_word("band"));
+
+	auto moved {std::move(builder)};
+	ASSERT_TRUE(moved.find_word("banana"));
+	ASSERT_FALSE(builder.find_word("banana"));
+	builder.insert("cat");
+	ASSERT_TRUE(builder.find_word("cat"));
+	ASSERT_FALSE(moved.find_word("cat"));
+}
+
+TEST(snapshots, t4_readers_while_building) {
+	auto const make_word = [](int i){
+		std::string res;
+		for (; i != 0; i /= 26) res += static_cast<char>('a' + i % 26);
+		return res;
+	};
+
+	::containers::trie::persistent_of_char builder;
+	for (int i = 1; i != 500; ++i) builder.insert(make_word(i));
+
+	//readers drop their snapshots while the builder is still inserting, half of them before it starts
+	std::atomic<bool> is_ok {true};
+	std::atomic<int> dropped {0};
+	std::vector<std::thread> readers;
+	for (int r = 0; r != 4; ++r) {
+		readers.emplace_back([&, r, snapshot = std::optional{builder.snapshot()}]() mutable {
+			for (int round = 0; round != (r % 2 == 0 ? 1 : 20); ++round) {
+				for (int i = 1; i != 500; ++i) {
+					if (!snapshot->find_word(make_word(i))) is_ok = false;
+				}
+				for (int i = 500; i != 1000; ++i) {
+					if (snapshot->find_word(make_word(i))) is_ok = false;
+				}
+			}
+			snapshot.reset();
+			++dropped;
+		});
+	}
+	while (dropped < 2) std::this_thread::yield();
+	for (int i = 500; i != 1000; ++i) builder.insert(make_word(i));
+	for (auto& reader : readers) reader.join();
+
+	ASSERT_TRUE(is_ok);
+	for (int i = 1; i != 1000; ++i) ASSERT_TRUE(builder.find_word(make_word(i))) << i;
+}
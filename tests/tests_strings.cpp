@@ -7,7 +7,12 @@
 #include "../include/trie.hpp"
 
 #include <string>
+#include <string_view>
+#include <span>
 #include <vector>
+#include <forward_list>
+#include <ranges>
+#include <sstream>
 #include <filesystem>
 #include <fstream>
 
@@ -148,3 +153,37 @@ TEST(strings, t5) {
 	ASSERT_TRUE(trie_upper_chars.is_prefix(std::string("AB")));
 	ASSERT_FALSE(trie_upper_chars.is_prefix(std::string("ABBACC")));
 }
+
+TEST(strings, t6_heterogeneous_keys) {
+	::containers::trie::of_char trie;
+	trie.insert("apple");
+	trie.insert(std::string_view("application"));
+
+	std::string const buffer {"GET /app HTTP/1.1"};
+	std::span<char const> const app {buffer.data() + 5, 3u};
+	ASSERT_FALSE(trie.find_word(app));
+	ASSERT_TRUE(trie.is_prefix(app));
+	ASSERT_EQ(trie.find_prefix(std::string_view(buffer).substr(5, 3)).size(), 3u);
+
+	char const* c_str {"apple"};
+	ASSERT_TRUE(trie.find_word(c_str));
+	ASSERT_TRUE(trie.find_word("apple"));
+	ASSERT_FALSE(trie.find_word("app"));
+	ASSERT_TRUE(trie.is_prefix("app"));
+	ASSERT_FALSE(trie.is_prefix("apples"));
+	ASSERT_FALSE(trie.find_word(""));
+	ASSERT_EQ(trie.find_prefix("applx").size(), 4u);
+	ASSERT_TRUE(trie.find_word(c_str, ::containers::trie::null_terminated));
+
+	//forward and input iterators with sentinels
+	std::forward_list<char> const word {'a', 'p', 'p', 'l', 'e'};
+	ASSERT_TRUE(trie.find_word(word));
+	ASSERT_TRUE(trie.is_prefix(word.begin(), word.end()));
+
+	std::istringstream in ("application");
+	ASSERT_TRUE(trie.find_word(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()));
+
+	ASSERT_TRUE(trie.is_prefix(std::views::take(std::string_view("applesauce"), 5)));
+	ASSERT_FALSE(trie.is_prefix(std::views::take(std::string_view("applesauce"), 6)));
+	ASSERT_FALSE(trie.find_word(std::views::counted(buffer.data() + 5, 3) | std::views::transform([](char c){ return c; })));
+}
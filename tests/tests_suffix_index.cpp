@@ -0,0 +1,83 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/suffix_index.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <random>
+
+namespace {
+
+	//documents are split at spaces, just as the index does at any symbol out of the alphabet
+	std::size_t count_brute_force (std::string_view document, std::string_view pattern) {
+		std::size_t res {0u};
+		for (std::size_t pos = document.find(pattern); pos != std::string_view::npos; pos = document.find(pattern, pos + 1u)) {
+			++res;
+		}
+		return res;
+	}
+
+}//!namespace
+
+TEST(suffix_index, t1_documents) {
+	std::vector<std::string> const corpus {"banana", "bandana", "cabana", "apple pie"};
+	::containers::trie::suffix_index_of_char const index (corpus);
+	ASSERT_EQ(index.documents_count(), 4u);
+
+	using ids = std::vector<std::uint32_t>;
+	auto const docs = [&](std::string_view p){
+		auto const res {index.documents(p)};
+		return ids(res.begin(), res.end());
+	};
+
+	ASSERT_EQ(docs("ana"), (ids{0u, 1u, 2u}));
+	ASSERT_EQ(docs("band"), (ids{1u}));
+	ASSERT_EQ(docs("ab"), (ids{2u}));
+	ASSERT_EQ(docs("pie"), (ids{3u}));
+	ASSERT_EQ(docs("a"), (ids{0u, 1u, 2u, 3u}));
+	ASSERT_TRUE(docs("epi").empty());
+	ASSERT_TRUE(docs("xyz").empty());
+	ASSERT_TRUE(docs("").empty());
+
+	ASSERT_EQ(index.count(std::string_view("ana")), 2u + 1u + 1u);
+	ASSERT_EQ(index.count(std::string_view("a")), 3u + 3u + 3u + 1u);
+	ASSERT_EQ(index.count(std::string_view("e pie")), 0u);
+	ASSERT_TRUE(index.contains(std::string_view("BANDANA")));
+	ASSERT_FALSE(index.contains(std::string_view("bananas")));
+}
+
+TEST(suffix_index, t2_random_vs_brute_force) {
+	std::mt19937 gen (42);
+	std::uniform_int_distribution<int> letter (0, 2), length (0, 40), pattern_length (1, 5);
+
+	std::vector<std::string> corpus (50);
+	for (auto& document : corpus) {
+		document.resize(static_cast<std::size_t>(length(gen)));
+		for (auto& c : document) c = static_cast<char>('a' + letter(gen));
+	}
+	corpus[7] = "abc abc";
+	::containers::trie::suffix_index_of_char const index (corpus);
+
+	for (int round = 0; round != 500; ++round) {
+		std::string pattern (static_cast<std::size_t>(pattern_length(gen)), ' ');
+		for (auto& c : pattern) c = static_cast<char>('a' + letter(gen));
+
+		std::size_t expected_count {0u};
+		std::vector<std::uint32_t> expected_docs;
+		for (std::uint32_t id = 0; id != corpus.size(); ++id) {
+			std::size_t const count {count_brute_force(corpus[id], pattern)};
+			expected_count += count;
+			if (count != 0u) expected_docs.push_back(id);
+		}
+		auto const actual_docs {index.documents(pattern)};
+		ASSERT_EQ(index.count(pattern), expected_count) << pattern;
+		ASSERT_EQ(std::vector<std::uint32_t>(actual_docs.begin(), actual_docs.end()), expected_docs) << pattern;
+		ASSERT_EQ(index.contains(pattern), expected_count != 0u) << pattern;
+	}
+	ASSERT_FALSE(index.contains(std::string_view("c a")));
+}
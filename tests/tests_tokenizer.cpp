@@ -0,0 +1,100 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/tokenizer.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <random>
+#include <sstream>
+#include <iterator>
+
+using tokens_t = std::vector<::containers::trie::token<std::size_t>>;
+
+auto greedy_brute_force = [](std::vector<std::string> const& vocabulary, std::string_view text) {
+	tokens_t res;
+	std::size_t pos {0u};
+	while (pos < text.size()) {
+		std::size_t best_len {0u}, best_id {0u};
+		//a key inserted again overwrites its payload, so the last one of the equal keys wins
+		for (std::size_t id = 0; id != vocabulary.size(); ++id) {
+			auto const& key {vocabulary[id]};
+			if (!key.empty() && key.size() >= best_len && text.substr(pos).starts_with(key)) {
+				best_len = key.size();
+				best_id = id;
+			}
+		}
+		if (best_len == 0u) {
+			++pos;
+			continue;
+		}
+		res.push_back({pos, best_len, best_id});
+		pos += best_len;
+	}
+	return res;
+};
+
+TEST(tokenizer, t1_buffer) {
+	std::vector<std::string> vocabulary {"a", "ab", "abc", "bc", "c"};
+	::containers::trie::tokenizer_of_char<> tokenizer (vocabulary);
+	ASSERT_EQ(tokenizer.max_key_length(), 3u);
+
+	std::string const text {"abcab bcx"};
+	tokens_t actual;
+	tokenizer.tokenize(text, std::back_inserter(actual));
+
+	tokens_t const expected {{0u, 3u, 2u}, {3u, 2u, 1u}, {6u, 2u, 3u}};
+	ASSERT_EQ(expected, actual);
+}
+
+TEST(tokenizer, t2_no_leaf_on_the_way) {
+	//"abcd" is never completed, so a walk must fall back to "a" and rescan from "b"
+	std::vector<std::string> vocabulary {"a", "abcd", "bc"};
+	::containers::trie::tokenizer_of_char<> tokenizer (vocabulary);
+
+	std::string const text {"abce"};
+	tokens_t actual;
+	tokenizer.tokenize(text, std::back_inserter(actual));
+	ASSERT_EQ(actual, greedy_brute_force(vocabulary, text));
+}
+
+TEST(tokenizer, t3_streaming_vs_buffer) {
+	std::mt19937 gen (42);
+	std::uniform_int_distribution<int> letter (0, 3), length (1, 6);
+
+	std::vector<std::string> vocabulary (40);
+	for (auto& key : vocabulary) {
+		key.resize(static_cast<std::size_t>(length(gen)));
+		for (auto& c : key) c = static_cast<char>('a' + letter(gen));
+	}
+	std::string text (5000, ' ');
+	for (auto& c : text) c = static_cast<char>('a' + letter(gen));
+	text[100] = text[777] = ' ';
+
+	::containers::trie::tokenizer_of_char<> tokenizer (vocabulary);
+
+	auto const expected {greedy_brute_force(vocabulary, text)};
+	tokens_t actual;
+	tokenizer.tokenize(text, std::back_inserter(actual));
+	ASSERT_EQ(expected, actual);
+
+	for (std::size_t chunk_size : {1u, 2u, 3u, 5u, 7u, 64u, 5000u}) {
+		auto stream {tokenizer.stream()};
+		tokens_t streamed;
+		for (std::size_t pos = 0; pos < text.size(); pos += chunk_size) {
+			std::string_view const chunk {std::string_view(text).substr(pos, chunk_size)};
+			stream.feed(chunk, std::back_inserter(streamed));
+		}
+		stream.finish(std::back_inserter(streamed));
+		ASSERT_EQ(expected, streamed) << chunk_size;
+	}
+
+	std::istringstream in (text);
+	tokens_t from_stream;
+	tokenizer.tokenize(in, std::back_inserter(from_stream), 13u);
+	ASSERT_EQ(expected, from_stream);
+}
@@ -0,0 +1,109 @@
+//
+// Created by Andrey Solovyev on 19/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/utf8_trie.hpp"
+
+#include <string>
+#include <string_view>
+
+TEST(utf8, t1_raw_bytes) {
+	::containers::trie::of_utf8 trie;
+	trie.insert("école");
+	trie.insert("привет");
+	trie.insert(u8"日本語");
+	trie.insert("hello, world!");
+
+	ASSERT_TRUE(trie.find_word("école"));
+	ASSERT_TRUE(trie.find_word(u8"привет"));
+	ASSERT_TRUE(trie.find_word("日本語"));
+	ASSERT_TRUE(trie.find_word("hello, world!"));
+	ASSERT_FALSE(trie.find_word("École"));
+	ASSERT_FALSE(trie.find_word("日本"));
+	ASSERT_TRUE(trie.is_prefix("日本"));
+	ASSERT_TRUE(trie.is_prefix("hello, "));
+	ASSERT_FALSE(trie.is_prefix("hello,  "));
+	ASSERT_FALSE(trie.find_word(""));
+}
+
+TEST(utf8, t2_prefix_is_cut_at_code_point) {
+	::containers::trie::of_utf8 trie;
+	trie.insert("né");     // 'n' 0xC3 0xA9
+	trie.insert("日本語");  // 0xE6 0x97 0xA5 ...
+
+	//"nè" shares 'n' 0xC3 with "né", but 0xC3 alone is not a code point
+	ASSERT_EQ(trie.find_prefix("nè"), "n");
+	ASSERT_EQ(trie.find_prefix("né!"), "né");
+	//"旧" shares the first two bytes with "日"
+	ASSERT_EQ(trie.find_prefix("日旧"), "日");
+	ASSERT_EQ(trie.find_prefix("x"), "");
+}
+
+TEST(utf8, t3_case_folding) {
+	::containers::trie::of_utf8_nocase trie;
+	trie.insert("École");
+	trie.insert("ПРИВЕТ мир");
+	trie.insert("ΑΘΗΝΑ");
+	trie.insert("a long ASCII key, longer than eight bytes");
+
+	ASSERT_TRUE(trie.find_word("école"));
+	ASSERT_TRUE(trie.find_word("ÉCOLE"));
+	ASSERT_TRUE(trie.find_word("привет МИР"));
+	ASSERT_TRUE(trie.find_word("αθηνα"));
+	ASSERT_TRUE(trie.find_word("A LONG ascii KEY, LONGER THAN EIGHT BYTES"));
+	ASSERT_FALSE(trie.find_word("A LONG ascii KEY, LONGER THAN EIGHT BYTE"));
+	ASSERT_TRUE(trie.is_prefix("A LONG ascii KEY, LONGER THAN EIGHT BYTE"));
+	ASSERT_TRUE(trie.is_prefix("прИВ"));
+	ASSERT_EQ(trie.find_prefix("ÉCOLIER"), "ÉCOL");
+}
+
+TEST(utf8, t4_fold_case) {
+	using ::containers::trie::utf8::fold_case;
+	ASSERT_EQ(fold_case("Hello, WORLD! [@`{]"), "hello, world! [@`{]");
+	ASSERT_EQ(fold_case("ÀÉÎÕÜ ŸĀĹŁ"), "àéîõü ÿāĺł");
+	ASSERT_EQ(fold_case("ΣΟΦΊΑ Москва ЁЖ"), "σοφία москва ёж");
+	ASSERT_EQ(fold_case("ΆΈΉΊΌΎΏ ΟΔΥΣΣΕΥΣ Οδυσσεύς"), "άέήίόύώ οδυσσευσ οδυσσεύσ");
+	ASSERT_EQ(fold_case("ЀЏАЯ"), "ѐџая");
+	ASSERT_EQ(fold_case("ԱՖ Հայաստան"), "աֆ հայաստան");
+	//Latin Extended-B and Additional, with Vietnamese, micro sign and long s
+	ASSERT_EQ(fold_case("ǄǅƁȺ VIỆT NAM ẞ µſ"), "ǆǆɓⱥ việt nam ß μs");
+	//Cyrillic and its Supplement: Ukrainian, Kazakh, Komi
+	ASSERT_EQ(fold_case("ҐАНОК ӘҚҢӨҮ Ӏ ԀԮ"), "ґанок әқңөү ӏ ԁԯ");
+	//Greek symbols and Greek Extended
+	ASSERT_EQ(fold_case("ϐϑϕϖϰϱϵ ἈΈᾈᾼῸ"), "βθφπκρε ἀέᾀᾳὸ");
+	ASSERT_EQ(fold_case("ABCDEFGHIJKLMNOPQRSTUVWXYZ日本"), "abcdefghijklmnopqrstuvwxyz日本");
+	//ill-formed bytes are kept as they are
+	ASSERT_EQ(fold_case(std::string_view("A\xC3" "B\xFF", 4u)), std::string_view("a\xC3" "b\xFF", 4u));
+}
+
+TEST(utf8, t5_overlong_and_surrogates) {
+	using ::containers::trie::utf8::fold_case;
+	//overlong '/', 'A' and U+0000, surrogates U+D800 and U+DFFF, U+110000: none is a code point, all stay raw bytes
+	for (std::string_view const ill_formed : {"\xC0\xAF", "\xE0\x81\x81", "\xE0\x80\xAF", "\xF0\x80\x80\xAF",
+	                                          "\xED\xA0\x80", "\xED\xBF\xBF", "\xF4\x90\x80\x80"}) {
+		ASSERT_EQ(fold_case(ill_formed), ill_formed);
+	}
+	//the smallest and the largest well-formed sequences next to them still fold as code points
+	ASSERT_EQ(fold_case("\xE0\xA0\x80\xED\x9F\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"),
+	          "\xE0\xA0\x80\xED\x9F\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF");
+
+	::containers::trie::of_utf8_nocase trie;
+	trie.insert("a/b");
+	trie.insert("a\xE0\x80\xAF" "c");
+	ASSERT_TRUE(trie.find_word("A/B"));
+	ASSERT_FALSE(trie.find_word("\xE0\x81\x81\xE0\x80\xAF" "b"));
+	ASSERT_FALSE(trie.find_word("a\xC0\xAF" "b"));
+	ASSERT_FALSE(trie.find_word("a/c"));
+	ASSERT_TRUE(trie.find_word("A\xE0\x80\xAF" "C"));
+}
+
+TEST(utf8, t6_case_folding_of_extended_blocks) {
+	::containers::trie::of_utf8_nocase trie;
+	for (auto const* word : {"ґанок", "việt", "ǆungla", "әліпби", "µs"}) trie.insert(word);
+	for (auto const* query : {"Ґанок", "VIỆT", "Ǆungla", "ǅungla", "Әліпби", "ΜS"}) {
+		ASSERT_TRUE(trie.find_word(query)) << query;
+	}
+	ASSERT_FALSE(trie.find_word("VIET"));
+}